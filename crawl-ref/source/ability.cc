@@ -3687,71 +3687,64 @@ vector<talent> your_talents(bool check_confused, bool include_unusable)
     if (you.duration[DUR_SONG_OF_SLAYING])
         _add_talent(talents, ABIL_STOP_SINGING, check_confused);
 
-    // Evocations from items.
-    if (you.scan_artefacts(ARTP_BLINK)
-        && !player_mutation_level(MUT_NO_ARTIFICE))
+    // Evocations from items.  MUT_NO_ARTIFICE forbids all of these, so
+    // check it once instead of scanning the equipment per ability.
+    if (!player_mutation_level(MUT_NO_ARTIFICE))
     {
-        _add_talent(talents, ABIL_EVOKE_BLINK, check_confused);
-    }
+        if (you.scan_artefacts(ARTP_BLINK))
+            _add_talent(talents, ABIL_EVOKE_BLINK, check_confused);
 
-    if (you.scan_artefacts(ARTP_FOG)
-        && !player_mutation_level(MUT_NO_ARTIFICE))
-    {
-        _add_talent(talents, ABIL_EVOKE_FOG, check_confused);
-    }
+        if (you.scan_artefacts(ARTP_FOG))
+            _add_talent(talents, ABIL_EVOKE_FOG, check_confused);
 
-    if (you.evokable_berserk() && !player_mutation_level(MUT_NO_ARTIFICE))
-        _add_talent(talents, ABIL_EVOKE_BERSERK, check_confused);
+        if (you.evokable_berserk())
+            _add_talent(talents, ABIL_EVOKE_BERSERK, check_confused);
 
-    if (you.evokable_invis() && !you.attribute[ATTR_INVIS_UNCANCELLABLE]
-        && !player_mutation_level(MUT_NO_ARTIFICE))
-    {
-        // Now you can only turn invisibility off if you have an
-        // activatable item.  Wands and potions will have to time
-        // out. -- bwr
-        if (you.duration[DUR_INVIS])
-            _add_talent(talents, ABIL_EVOKE_TURN_VISIBLE, check_confused);
-        else
-            _add_talent(talents, ABIL_EVOKE_TURN_INVISIBLE, check_confused);
-    }
+        if (you.evokable_invis() && !you.attribute[ATTR_INVIS_UNCANCELLABLE])
+        {
+            // Now you can only turn invisibility off if you have an
+            // activatable item.  Wands and potions will have to time
+            // out. -- bwr
+            if (you.duration[DUR_INVIS])
+                _add_talent(talents, ABIL_EVOKE_TURN_VISIBLE, check_confused);
+            else
+                _add_talent(talents, ABIL_EVOKE_TURN_INVISIBLE, check_confused);
+        }
 
-    if (you.evokable_flight() && !player_mutation_level(MUT_NO_ARTIFICE))
-    {
-        // Has no effect on permanently flying Tengu.
-        if (!you.permanent_flight() || !you.racial_permanent_flight())
+        if (you.evokable_flight())
         {
-            // You can still evoke perm flight if you have temporary one.
-            if (!you.flight_mode()
-                || !you.attribute[ATTR_PERM_FLIGHT]
-                   && you.wearing_ego(EQ_ALL_ARMOUR, SPARM_FLYING))
+            // Has no effect on permanently flying Tengu.
+            if (!you.permanent_flight() || !you.racial_permanent_flight())
             {
-                _add_talent(talents, ABIL_EVOKE_FLIGHT, check_confused);
+                // You can still evoke perm flight if you have temporary one.
+                if (!you.flight_mode()
+                    || !you.attribute[ATTR_PERM_FLIGHT]
+                       && you.wearing_ego(EQ_ALL_ARMOUR, SPARM_FLYING))
+                {
+                    _add_talent(talents, ABIL_EVOKE_FLIGHT, check_confused);
+                }
+                // Now you can only turn flight off if you have an
+                // activatable item.  Potions and spells will have to time
+                // out.
+                if (you.flight_mode()
+                    && !you.attribute[ATTR_FLIGHT_UNCANCELLABLE])
+                {
+                    _add_talent(talents, ABIL_STOP_FLYING, check_confused);
+                }
             }
-            // Now you can only turn flight off if you have an
-            // activatable item.  Potions and spells will have to time
-            // out.
-            if (you.flight_mode() && !you.attribute[ATTR_FLIGHT_UNCANCELLABLE])
-                _add_talent(talents, ABIL_STOP_FLYING, check_confused);
         }
-    }
 
-    if (you.wearing(EQ_RINGS, RING_TELEPORTATION)
-        && !player_mutation_level(MUT_NO_ARTIFICE)
-        && !crawl_state.game_is_sprint())
-    {
-        _add_talent(talents, ABIL_EVOKE_TELEPORTATION, check_confused);
-    }
+        if (you.wearing(EQ_RINGS, RING_TELEPORTATION)
+            && !crawl_state.game_is_sprint())
+        {
+            _add_talent(talents, ABIL_EVOKE_TELEPORTATION, check_confused);
+        }
 
-    if (you.wearing(EQ_RINGS, RING_TELEPORT_CONTROL)
-        && !player_mutation_level(MUT_NO_ARTIFICE))
-    {
-        _add_talent(talents, ABIL_EVOKE_TELEPORT_CONTROL, check_confused);
-    }
+        if (you.wearing(EQ_RINGS, RING_TELEPORT_CONTROL))
+            _add_talent(talents, ABIL_EVOKE_TELEPORT_CONTROL, check_confused);
 
-    if (you.scan_artefacts(ARTP_TWISTER)
-        && !player_mutation_level(MUT_NO_ARTIFICE))
-    {
-        _add_talent(talents, ABIL_EVOKE_TWISTER, check_confused);
+        if (you.scan_artefacts(ARTP_TWISTER))
+            _add_talent(talents, ABIL_EVOKE_TWISTER, check_confused);
     }
 
     // Find hotkeys for the non-hotkeyed talents.
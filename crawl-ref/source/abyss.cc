@@ -1206,13 +1206,28 @@ static void _update_abyss_terrain(const coord_def &p,
     }
 }
 
+// Upper bound on the number of squares still flagged MMT_TURNED_TO_FLOOR.
+// Conservative: squares can lose the flag to wipes and shifts without
+// this being decremented, so it is recounted whenever the grid is swept.
+static int _abyss_turned_to_floor_left = 0;
+
+// destroy_wall() flags squares MMT_TURNED_TO_FLOOR too (digging, Shatter,
+// LRD); it calls this so the sweep in _abyss_apply_terrain isn't skipped
+// while any are outstanding.
+void abyss_note_turned_to_floor()
+{
+    ++_abyss_turned_to_floor_left;
+}
+
 static void _destroy_all_terrain(bool vaults)
 {
+    _abyss_turned_to_floor_left = 0;
     for (rectangle_iterator ri(MAPGEN_BORDER); ri; ++ri)
     {
         if (vaults && env.level_map_mask(*ri) & MMT_VAULT)
             continue;
         env.level_map_mask(*ri) = MMT_TURNED_TO_FLOOR;
+        ++_abyss_turned_to_floor_left;
     }
 }
 
@@ -1262,43 +1277,57 @@ static void _abyss_apply_terrain(const map_bitmask &abyss_genlevel_mask,
 
     int ii = 0;
     int delta = you.time_taken * (you.abyss_speed + 40) / 200;
-    for (rectangle_iterator ri(MAPGEN_BORDER); ri; ++ri)
-    {
-        const coord_def p(*ri);
-        const coord_def abyss_coord = p + abyssal_state.major_coord;
-        bool turned_to_floor = map_masked(p, MMT_TURNED_TO_FLOOR);
-        if (used_queue && !turned_to_floor)
-            continue;
 
-        if (turned_to_floor && (now || x_chance_in_y(delta, 50))
-            || !turned_to_floor && !used_queue)
+    // In the steady state all morph updates come from the sample queue,
+    // and the sweep below would only be looking for squares still
+    // flagged MMT_TURNED_TO_FLOOR (set when an abyss teleport destroys
+    // all terrain); skip it once the flagged squares have run out, so
+    // each morph does work proportional to the expiring samples rather
+    // than the whole grid.
+    int turned_left = 0;
+    if (!used_queue || _abyss_turned_to_floor_left)
+    {
+        for (rectangle_iterator ri(MAPGEN_BORDER); ri; ++ri)
         {
-            ++ii;
-            _update_abyss_terrain(abyss_coord, abyss_genlevel_mask, morph);
-            env.level_map_mask(p) &= ~MMT_TURNED_TO_FLOOR;
-        }
-        if (morph)
-            continue;
+            const coord_def p(*ri);
+            const coord_def abyss_coord = p + abyssal_state.major_coord;
+            bool turned_to_floor = map_masked(p, MMT_TURNED_TO_FLOOR);
+            if (used_queue && !turned_to_floor)
+                continue;
 
-        // Place abyss exits, stone arches, and altars to liven up the scene
-        // (only on area creation, not on morphing).
-        _abyss_check_place_feat(p, exit_chance,
-                                &exits_wanted,
-                                &use_abyss_exit_map,
-                                DNGN_EXIT_ABYSS,
-                                abyss_genlevel_mask)
-        ||
-        _abyss_check_place_feat(p, 10000,
-                                &altars_wanted,
-                                nullptr,
-                                _abyss_pick_altar(),
-                                abyss_genlevel_mask)
-        ||
-        level_id::current().depth < brdepth[BRANCH_ABYSS]
-        && _abyss_check_place_feat(p, 1900, nullptr, nullptr,
-                                   DNGN_ABYSSAL_STAIR,
-                                   abyss_genlevel_mask);
+            if (turned_to_floor && (now || x_chance_in_y(delta, 50))
+                || !turned_to_floor && !used_queue)
+            {
+                ++ii;
+                _update_abyss_terrain(abyss_coord, abyss_genlevel_mask, morph);
+                env.level_map_mask(p) &= ~MMT_TURNED_TO_FLOOR;
+            }
+            else if (turned_to_floor)
+                ++turned_left;
+            if (morph)
+                continue;
+
+            // Place abyss exits, stone arches, and altars to liven up the
+            // scene (only on area creation, not on morphing).
+            _abyss_check_place_feat(p, exit_chance,
+                                    &exits_wanted,
+                                    &use_abyss_exit_map,
+                                    DNGN_EXIT_ABYSS,
+                                    abyss_genlevel_mask)
+            ||
+            _abyss_check_place_feat(p, 10000,
+                                    &altars_wanted,
+                                    nullptr,
+                                    _abyss_pick_altar(),
+                                    abyss_genlevel_mask)
+            ||
+            level_id::current().depth < brdepth[BRANCH_ABYSS]
+            && _abyss_check_place_feat(p, 1900, nullptr, nullptr,
+                                       DNGN_ABYSSAL_STAIR,
+                                       abyss_genlevel_mask);
+        }
     }
+    _abyss_turned_to_floor_left = turned_left;
     if (ii)
         dprf(DIAG_ABYSS, "Nuked %d features", ii);
     _ensure_player_habitable(false);
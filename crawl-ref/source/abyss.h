@@ -25,6 +25,7 @@ struct abyss_state
 extern abyss_state abyssal_state;
 
 void abyss_morph();
+void abyss_note_turned_to_floor();
 
 void banished(const string &who = "");
 void push_features_to_abyss();
@@ -74,14 +74,31 @@ void actor_near_iterator::advance()
 monster_near_iterator::monster_near_iterator(coord_def c, los_type los)
     : center(c), _los(los), viewer(nullptr), i(0)
 {
-    if (!valid(&menv[0]))
-        advance();
+    init();
 }
 
 monster_near_iterator::monster_near_iterator(const actor *a, los_type los)
     : center(a->pos()), _los(los), viewer(a), i(0)
 {
-    if (!valid(&menv[0]))
+    init();
+}
+
+void monster_near_iterator::init()
+{
+    if (_los != LOS_NONE)
+    {
+        // Nothing beyond LOS_RADIUS can pass cell_see_cell, so scan
+        // the bounding box of cells through env.mgrid instead of every
+        // monster slot.
+        tl.x = max(center.x - LOS_RADIUS, 0);
+        tl.y = max(center.y - LOS_RADIUS, 0);
+        br.x = min(center.x + LOS_RADIUS, GXM - 1);
+        br.y = min(center.y + LOS_RADIUS, GYM - 1);
+        cur = tl;
+        if (!valid(monster_at(cur)))
+            advance();
+    }
+    else if (!valid(&menv[0]))
         advance();
 }
 
@@ -92,6 +109,12 @@ monster_near_iterator::operator bool() const
 
 monster* monster_near_iterator::operator*() const
 {
+    if (_los != LOS_NONE)
+    {
+        if (cur.y <= br.y)
+            return monster_at(cur);
+        return nullptr;
+    }
     if (i < MAX_MONSTERS)
         return &menv[i];
     else
@@ -127,6 +150,21 @@ bool monster_near_iterator::valid(const monster* a) const
 
 void monster_near_iterator::advance()
 {
+    if (_los != LOS_NONE)
+    {
+        do
+        {
+            if (++cur.x > br.x)
+            {
+                cur.x = tl.x;
+                if (++cur.y > br.y)
+                    return;
+            }
+        }
+        while (!valid(monster_at(cur)));
+        return;
+    }
+
     do
          if (++i >= MAX_MONSTERS)
              return;
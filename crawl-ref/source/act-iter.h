@@ -44,12 +44,22 @@ protected:
     const coord_def center;
     los_type _los;
     const actor* viewer;
+    // Cell scan over the LOS bounding box; env.mgrid already indexes
+    // monsters by cell, so this beats walking every menv slot.
+    coord_def cur, tl, br;
+    // Slot scan, used only for LOS_NONE (which has no range bound).
     int i;
 
+    void init();
     bool valid(const monster* a) const;
     void advance();
 };
 
+// Iterates every live monster on the level by scanning the menv slots.
+// The slot index is load-bearing - mgrd and mindex() hold it and the
+// save format preserves it - so no packed live-list is kept; callers
+// needing a reference that survives the monster's death and slot reuse
+// should hold a mid_t (see monster_by_mid()) rather than an index.
 class monster_iterator
 {
 public:
@@ -59,11 +59,18 @@ typedef FixedArray<uint32_t, GXM, GYM> propgrid_t;
 static vector<area_centre> _agrid_centres;
 
 static propgrid_t _agrid;
+// Cells flagged by the last rebuild, so the next one clears only these
+// instead of wiping the full level grid.  Area footprints are a tiny
+// fraction of the level, and the rebuild runs on nearly every actor
+// move once any area source exists.
+static vector<coord_def> _agrid_flagged;
 static bool _agrid_valid = false;
 static bool no_areas = false;
 
 static void _set_agrid_flag(const coord_def& p, areaprop_flag f)
 {
+    if (!_agrid(p))
+        _agrid_flagged.push_back(p);
     _agrid(p) |= f;
 }
 
@@ -180,7 +187,9 @@ static void _update_agrid()
         return;
     }
 
-    _agrid.init(0);
+    for (const coord_def &p : _agrid_flagged)
+        _agrid(p) = 0;
+    _agrid_flagged.clear();
     _agrid_centres.clear();
 
     no_areas = true;
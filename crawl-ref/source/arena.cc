@@ -10,6 +10,7 @@
 #include "act-iter.h"
 #include "colour.h"
 #include "command.h"
+#include "dbg-prof.h"
 #include "dungeon.h"
 #include "end.h"
 #include "food.h"
@@ -108,6 +109,7 @@ namespace arena
     static bool move_respawns       = false;
 
     static bool miscasts            = false;
+    static bool bench               = false;
 
     static int  summon_throttle     = INT_MAX;
 
@@ -342,6 +344,12 @@ namespace arena
         if (arena_delay >= 0 && arena_delay < 2000)
             Options.view_delay = arena_delay;
 
+        // Benchmark mode wants raw throughput: no animation delays and
+        // no per-turn redraws.
+        bench = strip_tag(spec, "bench");
+        if (bench)
+            Options.view_delay = 0;
+
         string arena_place = strip_tag_prefix(spec, "arena_place:");
         if (!arena_place.empty())
         {
@@ -769,7 +777,8 @@ namespace arena
 
     static void do_fight()
     {
-        viewwindow();
+        if (!bench)
+            viewwindow();
         clear_messages(true);
         {
             cursor_control coff(false);
@@ -793,7 +802,8 @@ namespace arena
                 if ((turns++ % 100) == 0)
                     count_foes();
 
-                viewwindow();
+                if (!bench)
+                    viewwindow();
                 you.time_taken = 10;
                 // Make sure we don't starve.
                 you.hunger = HUNGER_MAXIMUM;
@@ -803,12 +813,14 @@ namespace arena
                 do_respawn(faction_a);
                 do_respawn(faction_b);
                 balance_spawners();
-                delay(Options.view_delay);
+                if (!bench)
+                    delay(Options.view_delay);
                 clear_messages();
                 dump_messages();
                 ASSERT(you.pet_target == MHITNOT);
             }
-            viewwindow();
+            if (!bench)
+                viewwindow();
         }
 
         clear_messages();
@@ -972,6 +984,7 @@ namespace arena
     static void simulate()
     {
         init_level_connectivity();
+        const int64_t bench_start = prof_time_micros();
         do
         {
             try
@@ -985,7 +998,7 @@ namespace arena
             }
             do_fight();
 
-            if (trials_done < total_trials)
+            if (trials_done < total_trials && !bench)
                 delay(Options.view_delay * 5);
         }
         while (!contest_cancelled && trials_done < total_trials);
@@ -997,7 +1010,23 @@ namespace arena
                  faction_b.desc.c_str(), trials_done - team_a_wins - ties,
                  ties);
         }
-        delay(Options.view_delay * 5);
+
+        if (bench)
+        {
+            const int64_t micros = prof_time_micros() - bench_start;
+            if (micros > 0 && trials_done > 0)
+            {
+                mprf("Benchmark: %d fight%s in %d.%03d seconds "
+                     "(%.2f fights/sec).",
+                     trials_done, trials_done == 1 ? "" : "s",
+                     (int)(micros / 1000000), (int)(micros / 1000 % 1000),
+                     trials_done * 1000000.0 / micros);
+            }
+            // Attribute the time: phase breakdown of the recent turns.
+            debug_turn_profile();
+        }
+        else
+            delay(Options.view_delay * 5);
 
         write_results();
     }
@@ -1087,18 +1087,40 @@ void artefact_properties(const item_def &item,
     artefact_properties(item, proprt, known);
 }
 
+// Single-property query.  This is what scan_artefacts() hits for every
+// equipped artefact on every resistance/AC lookup, so it reads just the
+// requested slot instead of unpacking all ART_PROPERTIES through the
+// CrawlStore vectors the way artefact_properties() does.
 int artefact_property(const item_def &item, artefact_prop_type prop,
                       bool &_known)
 {
-    artefact_properties_t  proprt;
-    artefact_known_props_t known;
-    proprt.init(0);
-    known.init(0);
+    ASSERT(is_artefact(item));
+    _known = false;
+    if (!item.props.exists(KNOWN_PROPS_KEY))
+        return 0;
 
-    artefact_properties(item, proprt, known);
+    if (item_ident(item, ISFLAG_KNOW_PROPERTIES))
+        _known = true;
+    else
+    {
+        const CrawlVector &known_vec = item.props[KNOWN_PROPS_KEY].get_vector();
+        _known = known_vec[prop];
+    }
 
-    _known = known[prop];
+    if (item.props.exists(ARTEFACT_PROPS_KEY))
+    {
+        const CrawlVector &rap_vec = item.props[ARTEFACT_PROPS_KEY].get_vector();
+        return rap_vec[prop].get_short();
+    }
 
+    if (is_unrandom_artefact(item))
+        return _seekunrandart(item)->prpty[prop];
+
+    // A randart with no stored properties; they can only be rederived
+    // as a full set.
+    artefact_properties_t proprt;
+    proprt.init(0);
+    _get_randart_properties(item, proprt);
     return proprt[prop];
 }
 
@@ -977,7 +977,7 @@ void bolt::destroy_wall_effect()
     case DNGN_RUNED_DOOR:
     case DNGN_SEALED_DOOR:
     {
-        set<coord_def> doors;
+        coord_set doors;
         find_connected_identical(pos(), doors);
         for (coord_def c : doors)
             destroy_wall(c);
@@ -6176,6 +6176,15 @@ void bolt::determine_affected_cells(explosion_map& m, const coord_def& delta,
 
     m(delta + centre) = min(count, m(delta + centre));
 
+    // If we are at a wall, only move to squares the caster can see; look
+    // the caster up once here rather than per neighbouring cell.
+    coord_def caster_pos;
+    if (at_wall)
+    {
+        const actor *caster = actor_by_mid(source_id);
+        caster_pos = caster ? caster->pos() : you.pos();
+    }
+
     // Now recurse in every direction.
     for (int i = 0; i < 8; ++i)
     {
@@ -6188,11 +6197,6 @@ void bolt::determine_affected_cells(explosion_map& m, const coord_def& delta,
         if (m(new_delta + centre) <= count)
             continue;
 
-        // If we were at a wall, only move to visible squares.
-        coord_def caster_pos = actor_by_mid(source_id) ?
-                                   actor_by_mid(source_id)->pos() :
-                                   you.pos();
-
         if (at_wall && !cell_see_cell(caster_pos, loc + Compass[i], LOS_NO_TRANS))
             continue;
 
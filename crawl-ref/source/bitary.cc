@@ -77,3 +77,12 @@ bit_vector bit_vector::operator & (const bit_vector& other) const
         res.data[w] = data[w] & other.data[w];
     return res;
 }
+
+bit_vector& bit_vector::or_and(const bit_vector& a, const bit_vector& b)
+{
+    ASSERT(size == a.size);
+    ASSERT(size == b.size);
+    for (int w = 0; w < nwords; ++w)
+        data[w] |= a.data[w] & b.data[w];
+    return *this;
+}
@@ -29,6 +29,14 @@ public:
     bit_vector& operator &= (const bit_vector& other);
     bit_vector  operator & (const bit_vector& other) const;
 
+    // *this |= (a & b), without building the intermediate vector.
+    bit_vector& or_and(const bit_vector& a, const bit_vector& b);
+
+    // Word-level access, for callers that walk set or clear bits in
+    // bulk (see the alive-ray scan in los.cc).
+    int wordcount() const { return nwords; }
+    unsigned long get_word(int w) const { return data[w]; }
+
 protected:
     unsigned long size;
     int nwords;
@@ -163,9 +163,11 @@ static void dump_section(dump_params &par)
 bool dump_char(const string &fname, bool quiet, bool full_id,
                const scorefile_entry *se)
 {
-    // Start with enough room for 100 80 character lines.
+    // Start with enough room for 100 80 character lines, plus a line
+    // per note: in a long game the note section dwarfs everything else,
+    // and growing a dump-sized buffer means recopying it repeatedly.
     string text;
-    text.reserve(100 * 80);
+    text.reserve(100 * 80 + note_list.size() * 80);
 
     dump_params par(text, "", full_id, se);
 
@@ -487,10 +487,22 @@ static void _handle_ghostly_flame(const cloud_struct& cloud)
 
 void manage_clouds()
 {
-    for (int i = 0; i < MAX_CLOUDS; ++i)
+    // Collect the active slots up front: the pass below both deletes
+    // clouds and creates new ones (fire over water spawns steam), and
+    // clouds appearing mid-pass shouldn't decay on the turn they form.
+    // This also means we stop scanning once all env.cloud_no active
+    // clouds are found rather than visiting all MAX_CLOUDS slots.
+    vector<int> active;
+    active.reserve(env.cloud_no);
+    for (int i = 0; i < MAX_CLOUDS && (int)active.size() < env.cloud_no; ++i)
+        if (env.cloud[i].type != CLOUD_NONE)
+            active.push_back(i);
+
+    for (int i : active)
     {
         cloud_struct& cloud = env.cloud[i];
 
+        // Deleted while handling an earlier cloud this pass.
         if (cloud.type == CLOUD_NONE)
             continue;
 
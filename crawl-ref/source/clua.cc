@@ -307,8 +307,13 @@ int CLua::loadfile(lua_State *ls, const char *filename, bool trusted,
     FileLineInput f(file.c_str());
     string script;
     while (!f.eof())
-        script += f.get_line() + "\n";
+    {
+        script += f.get_line();
+        script += '\n';
+    }
 
+    // Lua bytecode is not acceptable: as the 5.1 loader doesn't verify
+    // it, precompiled chunks can break out of the sandbox.
     if (script[0] == 0x1b)
         abort();
 
@@ -651,9 +656,19 @@ bool CLua::proc_returns(const char *par) const
 //
 void CLua::pushglobal(const string &name)
 {
-    vector<string> pieces = split_string(".", name);
     lua_State *ls(state());
 
+    // Almost every lookup is a plain hook name ("ch_start_running",
+    // "c_interrupt_activity", ...) fired once or more per player action;
+    // don't build a vector of string pieces just to walk no tables.
+    if (!name.empty() && name.find('.') == string::npos)
+    {
+        lua_getglobal(ls, name.c_str());
+        return;
+    }
+
+    vector<string> pieces = split_string(".", name);
+
     if (pieces.empty())
         lua_pushnil(ls);
 
@@ -28,13 +28,20 @@ struct random_element_colour_calc : public element_colour_calc
                                vector< pair<int, int> > _rand_vals)
         : element_colour_calc(_type, _name, (element_colour_calculator)_randomized_element_colour),
           rand_vals(_rand_vals)
-        {};
+        {
+            // Sample the weighted list once up front; get() is called
+            // per cell per redraw and then only needs an array index.
+            for (int i = 0; i < 120; ++i)
+                sampled[i] = _randomized_element_colour(i, coord_def(),
+                                                        rand_vals);
+        };
 
     virtual int get(const coord_def& loc = coord_def(),
                     bool non_random = false);
 
 protected:
     random_colour_map rand_vals;
+    int sampled[120]; // one colour per possible rand() roll
 };
 
 int element_colour_calc::rand(bool non_random)
@@ -49,15 +56,7 @@ int element_colour_calc::get(const coord_def& loc, bool non_random)
 
 int random_element_colour_calc::get(const coord_def& loc, bool non_random)
 {
-    // casting function pointers from other function pointers is guaranteed
-    // to be safe, but calling them on pointers not of their type isn't, so
-    // assert here to be safe - add to this assert if something different is
-    // needed
-    ASSERT((randomized_element_colour_calculator)calc ==
-                _randomized_element_colour);
-    randomized_element_colour_calculator real_calc =
-        (randomized_element_colour_calculator)calc;
-    return (*real_calc)(rand(non_random), loc, rand_vals);
+    return sampled[rand(non_random)];
 }
 
 colour_t random_colour(bool ui_rand)
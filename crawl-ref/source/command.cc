@@ -1446,6 +1446,7 @@ int list_wizard_commands(bool do_redraw_screen)
                        "<w>Ctrl-T</w> dungeon (D)Lua interpreter\n"
                        "<w>Ctrl-U</w> client (C)Lua interpreter\n"
                        "<w>Ctrl-X</w> Xom effect stats\n"
+                       "<w>Ctrl-L</w> dump recent turn timings\n"
 #ifdef DEBUG_DIAGNOSTICS
                        "<w>Ctrl-Q</w> make some debug messages quiet\n"
 #endif
@@ -0,0 +1,193 @@
+/**
+ * @file
+ * @brief Flat open-addressing hash set of grid coordinates.
+**/
+
+#ifndef COORD_SET_H
+#define COORD_SET_H
+
+#include <iterator>
+#include <vector>
+
+#include "coord.h"
+
+// A replacement for set<coord_def> on hot paths. Coordinates are packed
+// into a single 32-bit key and kept in a flat power-of-two probe table,
+// so membership tests and inserts scan a few adjacent words instead of
+// chasing red-black tree nodes, and nothing is allocated per element.
+// Unlike set<coord_def>, iteration runs in table order, not sorted
+// coordinate order.
+class coord_set
+{
+    // Coordinates are packed with a bias so the whole int16_t range is
+    // representable; the empty and deleted markers correspond to
+    // coordinates around (32767, 32767), which no real grid position
+    // ever reaches.
+    static const uint32_t EMPTY_SLOT   = 0xFFFFFFFF;
+    static const uint32_t DELETED_SLOT = 0xFFFFFFFE;
+
+    static uint32_t _pack(const coord_def &c)
+    {
+        return (uint32_t)(c.y + 0x8000) << 16 | (uint32_t)(c.x + 0x8000);
+    }
+
+    static coord_def _unpack(uint32_t key)
+    {
+        return coord_def((int)(key & 0xFFFF) - 0x8000,
+                         (int)(key >> 16) - 0x8000);
+    }
+
+public:
+    coord_set() : used(0), filled(0) { }
+
+    class const_iterator
+    {
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef coord_def            value_type;
+        typedef ptrdiff_t            difference_type;
+        typedef const coord_def*     pointer;
+        typedef coord_def            reference;
+
+        coord_def operator*() const { return _unpack(*slot); }
+
+        const_iterator &operator++()
+        {
+            ++slot;
+            _skip_holes();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const const_iterator &o) const
+        {
+            return slot == o.slot;
+        }
+
+        bool operator!=(const const_iterator &o) const
+        {
+            return slot != o.slot;
+        }
+
+    private:
+        friend class coord_set;
+
+        const_iterator(const uint32_t *s, const uint32_t *e)
+            : slot(s), sentinel(e)
+        {
+            _skip_holes();
+        }
+
+        void _skip_holes()
+        {
+            while (slot != sentinel && *slot >= DELETED_SLOT)
+                ++slot;
+        }
+
+        const uint32_t *slot, *sentinel;
+    };
+    typedef const_iterator iterator;
+
+    const_iterator begin() const
+    {
+        return const_iterator(table.data(), table.data() + table.size());
+    }
+
+    const_iterator end() const
+    {
+        const uint32_t *sentinel = table.data() + table.size();
+        return const_iterator(sentinel, sentinel);
+    }
+
+    size_t size() const { return used; }
+    bool empty() const { return used == 0; }
+
+    void clear()
+    {
+        table.clear();
+        used = filled = 0;
+    }
+
+    // Returns true if the coordinate was not in the set yet, like
+    // set<coord_def>::insert().second.
+    bool insert(const coord_def &c)
+    {
+        // Keep the table under 3/4 full (counting deletion markers) so
+        // probe runs stay short and always hit an empty slot.
+        if (filled * 4 >= table.size() * 3)
+            _grow();
+
+        const uint32_t key = _pack(c);
+        const size_t mask = table.size() - 1;
+        size_t free_slot = table.size();
+        size_t i = hash_coord(c) & mask;
+        while (table[i] != EMPTY_SLOT)
+        {
+            if (table[i] == key)
+                return false;
+            if (table[i] == DELETED_SLOT && free_slot == table.size())
+                free_slot = i;
+            i = (i + 1) & mask;
+        }
+
+        if (free_slot != table.size())
+            i = free_slot;
+        else
+            ++filled;
+        table[i] = key;
+        ++used;
+        return true;
+    }
+
+    template <typename It>
+    void insert(It b, It e)
+    {
+        for (; b != e; ++b)
+            insert(*b);
+    }
+
+    size_t count(const coord_def &c) const
+    {
+        if (table.empty())
+            return 0;
+        const size_t mask = table.size() - 1;
+        const uint32_t key = _pack(c);
+        for (size_t i = hash_coord(c) & mask; ; i = (i + 1) & mask)
+        {
+            if (table[i] == key)
+                return 1;
+            if (table[i] == EMPTY_SLOT)
+                return 0;
+        }
+    }
+
+    void erase(const const_iterator &it)
+    {
+        table[it.slot - table.data()] = DELETED_SLOT;
+        --used;
+    }
+
+private:
+    void _grow()
+    {
+        vector<uint32_t> old;
+        old.swap(table);
+        table.assign(old.empty() ? 64 : old.size() * 2, EMPTY_SLOT);
+        used = filled = 0;
+        for (uint32_t key : old)
+            if (key < DELETED_SLOT)
+                insert(_unpack(key));
+    }
+
+    vector<uint32_t> table;
+    size_t used;    // live entries
+    size_t filled;  // live entries plus deletion markers
+};
+
+#endif
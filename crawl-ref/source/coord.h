@@ -1,8 +1,18 @@
 #ifndef COORD_H
 #define COORD_H
 
+#include "hash.h"
+
 coord_def random_in_bounds();
 
+// Coordinate hashing for per-cell procedural noise; identical to
+// hash3(c.x, c.y, seed) but spares the caller the unpacking. Inline,
+// since this sits in the inner loop of procedural layout generation.
+static inline uint64_t hash_coord(const coord_def &c, uint64_t seed = 0)
+{
+    return hash3(c.x, c.y, seed);
+}
+
 static inline bool in_bounds_x(int x)
 {
     return x > X_BOUND_1 && x < X_BOUND_2;
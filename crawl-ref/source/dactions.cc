@@ -380,10 +380,68 @@ static void _apply_daction(daction_type act)
     }
 }
 
+// Does _apply_daction() handle this action with a sweep over the
+// monster list?  Such sweeps can be fused by catchup_dactions().
+static bool _daction_sweeps_monsters(daction_type act)
+{
+    switch (act)
+    {
+    case DACT_ALLY_HOLY:
+    case DACT_ALLY_UNHOLY_EVIL:
+    case DACT_ALLY_UNCLEAN_CHAOTIC:
+    case DACT_ALLY_SPELLCASTER:
+    case DACT_ALLY_YRED_SLAVE:
+    case DACT_ALLY_BEOGH:
+    case DACT_ALLY_SLIME:
+    case DACT_ALLY_PLANT:
+    case DACT_ALLY_TROG:
+    case DACT_ALLY_MAKHLEB:
+    case DACT_OLD_ENSLAVED_SOULS_POOF:
+    case DACT_SLIME_NEW_ATTEMPT:
+    case DACT_HOLY_PETS_GO_NEUTRAL:
+    case DACT_PIKEL_SLAVES:
+    case DACT_KIRKE_HOGS:
+    case DACT_BRIBE_TIMEOUT:
+    case DACT_SET_BRIBES:
+        return true;
+    default:
+        return false;
+    }
+}
+
 void catchup_dactions()
 {
     while (env.dactions_done < you.dactions.size())
-        _apply_daction(you.dactions[env.dactions_done++]);
+    {
+        // Long games queue up dozens of dactions, most of them monster
+        // sweeps; replaying them on level load one full sweep at a time
+        // adds up.  Fuse each run of consecutive monster sweeps into a
+        // single pass that applies them, still in order, per monster.
+        unsigned int last = env.dactions_done;
+        while (_daction_sweeps_monsters(you.dactions[last])
+               && last + 1 < you.dactions.size()
+               && _daction_sweeps_monsters(you.dactions[last + 1]))
+        {
+            last++;
+        }
+
+        if (last == env.dactions_done)
+        {
+            _apply_daction(you.dactions[env.dactions_done++]);
+            continue;
+        }
+
+        for (monster_iterator mi; mi; ++mi)
+            for (unsigned int i = env.dactions_done; i <= last; i++)
+            {
+                // A monster killed by an earlier action in the run no
+                // longer matches anything.
+                const daction_type act = you.dactions[i];
+                if (mons_matches_daction(*mi, act))
+                    apply_daction_to_mons(*mi, act, true, false);
+            }
+        env.dactions_done = last + 1;
+    }
 }
 
 unsigned int query_daction_counter(daction_type c)
@@ -69,6 +69,26 @@ static string _query_database(TextDB &db, string key, bool canonicalise_key,
                               bool run_lua, bool untranslated = false);
 static void _add_entry(DBM *db, const string &k, string &v);
 
+// The ?/ searches walk every key in a database, and the key set never
+// changes within a run; walk each database once and keep the list.
+static map<DBM *, vector<string> > _db_key_cache;
+
+static const vector<string> &_all_database_keys(DBM *database)
+{
+    auto it = _db_key_cache.find(database);
+    if (it != _db_key_cache.end())
+        return it->second;
+
+    vector<string> &keys = _db_key_cache[database];
+    datum dbKey = dbm_firstkey(database);
+    while (dbKey.dptr != nullptr)
+    {
+        keys.push_back(string((const char *)dbKey.dptr, dbKey.dsize));
+        dbKey = dbm_nextkey(database);
+    }
+    return keys;
+}
+
 static TextDB AllDBs[] =
 {
     TextDB("descriptions", "descript/",
@@ -366,6 +386,9 @@ void databaseSystemInit()
 
 void databaseSystemShutdown()
 {
+    // The handles the key lists were walked from are about to go away.
+    _db_key_cache.clear();
+
     for (unsigned int i = 0; i < NUM_DB; i++)
         AllDBs[i].shutdown(true);
 }
@@ -390,28 +413,42 @@ static datum _database_fetch(DBM *database, const string &key)
     return result;
 }
 
+// Cache of compiled patterns for keyed lookups.  text_pattern compiles
+// lazily and keeps the compiled form inside the object, so keeping the
+// objects alive between lookups is all it takes to stop help searches
+// and FAQ key scans from recompiling the same few regexes.  The cache
+// only ever holds search patterns, but cap it anyway in case a session
+// gets adventurous.
+static text_pattern &_compiled_pattern(const string &regex, bool ignore_case)
+{
+    static map<pair<string, bool>, text_pattern> cache;
+
+    if (cache.size() > 100)
+        cache.clear();
+
+    const pair<string, bool> key(regex, ignore_case);
+    auto it = cache.find(key);
+    if (it == cache.end())
+        it = cache.insert(make_pair(key, text_pattern(regex, ignore_case))).first;
+    return it->second;
+}
+
 static vector<string> _database_find_keys(DBM *database,
                                           const string &regex,
                                           bool ignore_case,
                                           db_find_filter filter = nullptr)
 {
-    text_pattern             tpat(regex, ignore_case);
+    const text_pattern &tpat = _compiled_pattern(regex, ignore_case);
     vector<string> matches;
 
-    datum dbKey = dbm_firstkey(database);
-
-    while (dbKey.dptr != nullptr)
+    for (const string &key : _all_database_keys(database))
     {
-        string key((const char *)dbKey.dptr, dbKey.dsize);
-
-        if (tpat.matches(key)
-            && key.find("__") == string::npos
+        if (key.find("__") == string::npos
+            && tpat.matches(key)
             && (filter == nullptr || !(*filter)(key, "")))
         {
             matches.push_back(key);
         }
-
-        dbKey = dbm_nextkey(database);
     }
 
     return matches;
@@ -422,26 +459,23 @@ static vector<string> _database_find_bodies(DBM *database,
                                             bool ignore_case,
                                             db_find_filter filter = nullptr)
 {
-    text_pattern             tpat(regex, ignore_case);
+    const text_pattern &tpat = _compiled_pattern(regex, ignore_case);
     vector<string> matches;
 
-    datum dbKey = dbm_firstkey(database);
-
-    while (dbKey.dptr != nullptr)
+    for (const string &key : _all_database_keys(database))
     {
-        string key((const char *)dbKey.dptr, dbKey.dsize);
+        // Don't bother fetching bodies of keys we'd discard anyway.
+        if (key.find("__") != string::npos)
+            continue;
 
-        datum dbBody = dbm_fetch(database, dbKey);
+        datum dbBody = _database_fetch(database, key);
         string body((const char *)dbBody.dptr, dbBody.dsize);
 
         if (tpat.matches(body)
-            && key.find("__") == string::npos
             && (filter == nullptr || !(*filter)(key, body)))
         {
             matches.push_back(key);
         }
-
-        dbKey = dbm_nextkey(database);
     }
 
     return matches;
@@ -624,8 +658,23 @@ static string _getWeightedString(TextDB &db, const string &key,
     string canonical_key = key + suffix;
     lowercase(canonical_key);
 
+    // Speech lookups probe long chains of prefixed keys that mostly
+    // miss; the raw text behind a key never changes within a run, so
+    // memoise it - misses included - and leave only the weighted
+    // choice to the dice.
+    static map<pair<const TextDB*, string>, string> weighted_cache;
+    const pair<const TextDB*, string> ckey(&db, canonical_key);
+    auto cached = weighted_cache.find(ckey);
+    if (cached != weighted_cache.end())
+    {
+        if (cached->second.empty())
+            return "";
+        return _chooseStrByWeight(cached->second, fixed_weight);
+    }
+
     // Query the DB.
     datum result;
+    result.dsize = 0;
 
     if (db.translation)
         result = _database_fetch(db.translation->get(), canonical_key);
@@ -635,21 +684,27 @@ static string _getWeightedString(TextDB &db, const string &key,
     if (result.dsize <= 0)
     {
         // Try ignoring the suffix.
-        canonical_key = key;
-        lowercase(canonical_key);
+        string nosuffix_key = key;
+        lowercase(nosuffix_key);
 
         // Query the DB.
         if (db.translation)
-            result = _database_fetch(db.translation->get(), canonical_key);
+            result = _database_fetch(db.translation->get(), nosuffix_key);
         if (result.dsize <= 0)
-            result = _database_fetch(db.get(), canonical_key);
-
-        if (result.dsize <= 0)
-            return "";
+            result = _database_fetch(db.get(), nosuffix_key);
     }
 
     // Cons up a (C++) string to return.  The caller must release it.
-    string str = string((const char *)result.dptr, result.dsize);
+    string str;
+    if (result.dsize > 0)
+        str = string((const char *)result.dptr, result.dsize);
+
+    if (weighted_cache.size() >= 1000)
+        weighted_cache.clear();
+    weighted_cache[ckey] = str;
+
+    if (str.empty())
+        return "";
 
     return _chooseStrByWeight(str, fixed_weight);
 }
@@ -728,8 +783,15 @@ static void _call_recursive_replacement(string &str, TextDB &db,
     } // while (pos != string::npos)
 }
 
-static string _query_database(TextDB &db, string key, bool canonicalise_key,
-                              bool run_lua, bool untranslated)
+// Memoised raw lookups.  The database files never change during a run,
+// so the fetched text (after alias chasing, before embedded lua) is a
+// pure function of the key; multi-kilobyte descriptions otherwise get
+// re-fetched every time something is examined.  Indexed by the
+// untranslated flag, since that changes which db answers.
+static map<pair<const TextDB*, string>, string> _query_cache[2];
+
+static string _query_database_raw(TextDB &db, string key,
+                                  bool canonicalise_key, bool untranslated)
 {
     if (canonicalise_key)
     {
@@ -738,29 +800,50 @@ static string _query_database(TextDB &db, string key, bool canonicalise_key,
         lowercase(key);
     }
 
+    auto &cache = _query_cache[untranslated];
+    const pair<const TextDB*, string> ckey(&db, key);
+    auto it = cache.find(ckey);
+    if (it != cache.end())
+        return it->second;
+
     // Query the DB.
     datum result;
+    result.dsize = 0;
 
     if (db.translation && !untranslated)
         result = _database_fetch(db.translation->get(), key);
     if (result.dsize <= 0)
         result = _database_fetch(db.get(), key);
 
-    if (result.dsize <= 0)
-        return "";
-
-    string str((const char *)result.dptr, result.dsize);
-
-    // <foo> is an alias to key foo
-    if (str[0] == '<' && str[str.size() - 2] == '>'
-        && str.find('<', 1) == str.npos
-        && str.find('\n') == str.size() - 1)
+    string str;
+    if (result.dsize > 0)
     {
-        return _query_database(db, str.substr(1, str.size() - 3),
-                               canonicalise_key, run_lua, untranslated);
+        str = string((const char *)result.dptr, result.dsize);
+
+        // <foo> is an alias to key foo
+        if (str[0] == '<' && str[str.size() - 2] == '>'
+            && str.find('<', 1) == str.npos
+            && str.find('\n') == str.size() - 1)
+        {
+            str = _query_database_raw(db, str.substr(1, str.size() - 3),
+                                      canonicalise_key, untranslated);
+        }
     }
 
-    if (run_lua)
+    if (cache.size() > 1000)
+        cache.clear();
+    cache[ckey] = str;
+
+    return str;
+}
+
+static string _query_database(TextDB &db, string key, bool canonicalise_key,
+                              bool run_lua, bool untranslated)
+{
+    // Lua runs on the caller's copy of the cached text, so entries with
+    // embedded scripts stay dynamic.
+    string str = _query_database_raw(db, key, canonicalise_key, untranslated);
+    if (run_lua && !str.empty())
         _execute_embedded_lua(str);
 
     return str;
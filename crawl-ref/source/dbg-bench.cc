@@ -0,0 +1,211 @@
+/**
+ * @file
+ * @brief Microbenchmarks for core data structures ("make bench").
+ *
+ * Each benchmark runs a fixed number of iterations against a canned,
+ * deterministic level fixture, so the numbers are comparable between
+ * runs and releases.  Results go to stderr for humans and to bench.json
+ * for CI-side tracking.  Invoked via "crawl -bench" or "make bench";
+ * benchmark an optimised build, not a debug one.
+**/
+
+#include "AppHdr.h"
+
+#include "dbg-bench.h"
+
+#include "coordit.h"
+#include "dbg-prof.h"
+#include "end.h"
+#include "env.h"
+#include "los_def.h"
+#include "map_knowledge.h"
+#include "noise.h"
+#include "player.h"
+#include "store.h"
+#include "stringutil.h"
+#include "travel.h"
+
+// Swallows benchmark results so the loops can't be optimised away.
+static volatile int64_t _sink = 0;
+
+static FILE *_json = nullptr;
+static bool _json_first = true;
+
+static void _report(const char *name, int iters, int64_t micros)
+{
+    fprintf(stderr, "bench: %-24s %8d iters %9d us  %10.3f us/iter\n",
+            name, iters, (int)micros, (double)micros / iters);
+    if (_json)
+    {
+        fprintf(_json,
+                "%s\n    {\"name\": \"%s\", \"iterations\": %d, "
+                "\"microseconds\": %d}",
+                _json_first ? "" : ",", name, iters, (int)micros);
+        _json_first = false;
+    }
+}
+
+// An open level with a pillar every fourth square: open enough for
+// noise and LOS to spread widely, blocked enough to exercise the wall
+// handling.  No randomness, so every run floods the same cells.
+static void _setup_fixture_level()
+{
+    grd.init(DNGN_ROCK_WALL);
+    for (rectangle_iterator ri(1); ri; ++ri)
+    {
+        if (ri->x % 4 == 0 && ri->y % 4 == 0)
+            grd(*ri) = DNGN_STONE_WALL;
+        else
+            grd(*ri) = DNGN_FLOOR;
+    }
+
+    // Travel works on the known map, not the real one.
+    for (rectangle_iterator ri(0); ri; ++ri)
+    {
+        env.map_knowledge(*ri).set_feature(grd(*ri));
+        env.map_knowledge(*ri).flags |= MAP_SEEN_FLAG;
+    }
+
+    you.moveto(coord_def(GXM / 2, GYM / 2));
+}
+
+static void _bench_fixedarray()
+{
+    static FixedArray<int, GXM, GYM> arr;
+    for (int x = 0; x < GXM; ++x)
+        for (int y = 0; y < GYM; ++y)
+            arr[x][y] = x + y;
+
+    const int iters = 2000;
+
+    // Inner loop over the second index: walks each column contiguously.
+    int64_t start = prof_time_micros();
+    int64_t sum = 0;
+    for (int i = 0; i < iters; ++i)
+        for (int x = 0; x < GXM; ++x)
+            for (int y = 0; y < GYM; ++y)
+                sum += arr[x][y];
+    _sink += sum;
+    _report("fixedarray_xy", iters, prof_time_micros() - start);
+
+    // Inner loop over the first index: strides GYM ints per step.
+    start = prof_time_micros();
+    sum = 0;
+    for (int i = 0; i < iters; ++i)
+        for (int y = 0; y < GYM; ++y)
+            for (int x = 0; x < GXM; ++x)
+                sum += arr[x][y];
+    _sink += sum;
+    _report("fixedarray_yx", iters, prof_time_micros() - start);
+}
+
+static void _bench_hashtable()
+{
+    const int nkeys = 1000;
+    vector<string> keys;
+    for (int i = 0; i < nkeys; ++i)
+        keys.push_back(make_stringf("bench_key_%04d", i));
+
+    const int iters = 100;
+
+    int64_t start = prof_time_micros();
+    for (int i = 0; i < iters; ++i)
+    {
+        CrawlHashTable table;
+        for (int k = 0; k < nkeys; ++k)
+            table[keys[k]] = k;
+        _sink += table.size();
+    }
+    _report("hashtable_insert", iters * nkeys, prof_time_micros() - start);
+
+    CrawlHashTable table;
+    for (int k = 0; k < nkeys; ++k)
+        table[keys[k]] = k;
+
+    start = prof_time_micros();
+    int64_t sum = 0;
+    for (int i = 0; i < iters; ++i)
+        for (int k = 0; k < nkeys; ++k)
+            sum += table[keys[k]].get_int();
+    _sink += sum;
+    _report("hashtable_lookup", iters * nkeys, prof_time_micros() - start);
+}
+
+static void _bench_los_update()
+{
+    const coord_def c1(GXM / 2, GYM / 2);
+    const coord_def c2(GXM / 2 + 1, GYM / 2);
+    los_def lof(c1);
+
+    const int iters = 2000;
+    const int64_t start = prof_time_micros();
+    for (int i = 0; i < iters; ++i)
+    {
+        // Alternate centers so the recompute can't be skipped as
+        // already valid.
+        lof.set_center(i & 1 ? c2 : c1);
+        lof.update();
+    }
+    _sink += lof.see_cell(c2);
+    _report("los_update", iters, prof_time_micros() - start);
+}
+
+static void _bench_noise_propagation()
+{
+    noise_grid ng;
+    const coord_def center(GXM / 2, GYM / 2);
+
+    const int iters = 500;
+    const int64_t start = prof_time_micros();
+    for (int i = 0; i < iters; ++i)
+    {
+        // A shout-loud noise from the level center.
+        ng.register_noise(noise_t(center, "", 12 * 1000, MID_NOBODY));
+        ng.propagate_noise();
+        ng.reset();
+    }
+    _report("noise_propagate", iters, prof_time_micros() - start);
+}
+
+static void _bench_travel_pathfind()
+{
+    const coord_def src(2, 2);
+    const coord_def dst(GXM - 3, GYM - 3);
+
+    const int iters = 200;
+    const int64_t start = prof_time_micros();
+    coord_def next;
+    for (int i = 0; i < iters; ++i)
+    {
+        travel_pathfind tp;
+        tp.set_src_dst(src, dst);
+        tp.set_ignore_danger();
+        next = tp.pathfind(RMODE_TRAVEL);
+    }
+    _sink += next.x + next.y;
+    _report("travel_pathfind", iters, prof_time_micros() - start);
+}
+
+void run_benchmarks()
+{
+    _json = fopen("bench.json", "w");
+    if (_json)
+        fprintf(_json, "[");
+
+    _setup_fixture_level();
+
+    _bench_fixedarray();
+    _bench_hashtable();
+    _bench_los_update();
+    _bench_noise_propagation();
+    _bench_travel_pathfind();
+
+    if (_json)
+    {
+        fprintf(_json, "\n]\n");
+        fclose(_json);
+        _json = nullptr;
+    }
+
+    end(0, false, "Benchmarks complete; results in bench.json");
+}
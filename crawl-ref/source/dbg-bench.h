@@ -0,0 +1,11 @@
+/**
+ * @file
+ * @brief Microbenchmarks for core data structures ("make bench").
+**/
+
+#ifndef DBGBENCH_H
+#define DBGBENCH_H
+
+NORETURN void run_benchmarks();
+
+#endif
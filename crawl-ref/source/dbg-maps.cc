@@ -7,6 +7,13 @@
 
 #include "dbg-maps.h"
 
+#include <ctime>
+#ifdef UNIX
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include "branch.h"
 #include "chardump.h"
 #include "crash.h"
@@ -18,7 +25,9 @@
 #include "maps.h"
 #include "message.h"
 #include "ng-init.h"
+#include "options.h"
 #include "player.h"
+#include "random.h"
 #include "shopping.h"
 #include "state.h"
 #include "stringutil.h"
@@ -44,6 +53,14 @@ static int levels_tried = 0, levels_failed = 0;
 static int build_attempts = 0, level_vetoes = 0;
 // Map from message to counts.
 static map<string, int> veto_messages;
+// Clock ticks spent resolving and placing each map; see vault_main().
+static map<string, int64_t> map_build_ticks;
+
+// When iterations are partitioned across forked workers, each child
+// gets a worker number; only worker 0 (also the serial case) keeps the
+// progress display and keyboard cancel.
+static int _mapstat_worker = 0;
+static bool _mapstat_forked = false;
 
 void mapstat_report_map_build_start()
 {
@@ -72,19 +89,23 @@ static bool _is_disconnected_level()
 
 static bool _do_build_level()
 {
-    clear_messages();
-    mprf("On %s; %d g, %d fail, %u err%s, %u uniq, "
-         "%d try, %d (%.2lf%%) vetos",
-         level_id::current().describe().c_str(), levels_tried, levels_failed,
-         (unsigned int)errors.size(), last_error.empty() ? ""
-         : (" (" + last_error + ")").c_str(), (unsigned int) use_count.size(),
-         build_attempts, level_vetoes,
-         build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
+    if (_mapstat_worker == 0)
+    {
+        clear_messages();
+        mprf("On %s; %d g, %d fail, %u err%s, %u uniq, "
+             "%d try, %d (%.2lf%%) vetos",
+             level_id::current().describe().c_str(), levels_tried,
+             levels_failed, (unsigned int)errors.size(),
+             last_error.empty() ? "" : (" (" + last_error + ")").c_str(),
+             (unsigned int) use_count.size(),
+             build_attempts, level_vetoes,
+             build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
+    }
 
     watchdog();
 
     no_messages mx;
-    if (kbhit() && key_is_escape(getchk()))
+    if (!_mapstat_forked && kbhit() && key_is_escape(getchk()))
     {
         mprf(MSGCH_WARN, "User requested cancel");
         return false;
@@ -157,7 +178,10 @@ static bool _do_build_level()
         if (!vaults.empty())
             vaults = " (" + vaults + ")";
 
-        FILE *fp = fopen("map.dump", "w");
+        const string dump_name =
+            _mapstat_forked ? make_stringf("map.%d.dump", _mapstat_worker)
+                            : "map.dump";
+        FILE *fp = fopen(dump_name.c_str(), "w");
         fprintf(fp, "Bad (disconnected) level (%s) on %s%s.\n\n",
                 env.level_build_method.c_str(),
                 level_id::current().describe().c_str(),
@@ -239,24 +263,23 @@ static bool _build_dungeon()
  * builder() fails, as the level may be in an invalid state and any object
  * statistics erroneous.
 */
-bool mapstat_build_levels()
+static bool _build_iterations(int first, int last)
 {
-    if (!generated_levels.size())
-        _dungeon_places();
-    printf("Iteration: ");
-    fflush(stdout);
-    for (int i = 0; i < SysEnv.map_gen_iters; ++i)
+    for (int i = first; i < last; ++i)
     {
-        clear_messages();
-        mprf("On %d of %d; %d g, %d fail, %u err%s, %u uniq, "
-             "%d try, %d (%.2lf%%) vetoes",
-             i, SysEnv.map_gen_iters, levels_tried, levels_failed,
-             (unsigned int)errors.size(),
-             last_error.empty() ? "" : (" (" + last_error + ")").c_str(),
-             (unsigned int)use_count.size(), build_attempts, level_vetoes,
-             build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
-        printf("%d..", i + 1);
-        fflush(stdout);
+        if (_mapstat_worker == 0)
+        {
+            clear_messages();
+            mprf("On %d of %d; %d g, %d fail, %u err%s, %u uniq, "
+                 "%d try, %d (%.2lf%%) vetoes",
+                 i, SysEnv.map_gen_iters, levels_tried, levels_failed,
+                 (unsigned int)errors.size(),
+                 last_error.empty() ? "" : (" (" + last_error + ")").c_str(),
+                 (unsigned int)use_count.size(), build_attempts, level_vetoes,
+                 build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
+            printf("%d..", i + 1);
+            fflush(stdout);
+        }
         dlua.callfn("dgn_clear_data", "");
         you.uniq_map_tags.clear();
         you.uniq_map_names.clear();
@@ -268,6 +291,188 @@ bool mapstat_build_levels()
         if (crawl_state.obj_stat_gen)
             objstat_iteration_stats();
     }
+    return true;
+}
+
+#ifdef UNIX
+// Streams a worker's tallies over its pipe as one line per entry; map
+// names and level descriptions contain no whitespace, so a plain
+// space-separated format is enough. Veto messages are free text and go
+// last on their line; map errors additionally hold the name and the
+// message apart with a tab.
+static void _write_worker_stats(FILE *fp)
+{
+    fprintf(fp, "counts %d %d %d %d\n", levels_tried, levels_failed,
+            build_attempts, level_vetoes);
+    for (const auto &entry : try_count)
+        fprintf(fp, "try %d %s\n", entry.second, entry.first.c_str());
+    for (const auto &entry : use_count)
+        fprintf(fp, "use %d %s\n", entry.second, entry.first.c_str());
+    for (const auto &entry : map_build_ticks)
+    {
+        fprintf(fp, "time %lld %s\n", (long long) entry.second,
+                entry.first.c_str());
+    }
+    for (const auto &entry : map_builds)
+    {
+        fprintf(fp, "builds %d %d %s\n", entry.second.first,
+                entry.second.second, entry.first.describe().c_str());
+    }
+    for (const auto &entry : level_mapsused)
+    {
+        for (const string &name : entry.second)
+        {
+            fprintf(fp, "placed %s %s\n", entry.first.describe().c_str(),
+                    name.c_str());
+        }
+    }
+    for (const auto &entry : veto_messages)
+        fprintf(fp, "veto %d %s\n", entry.second, entry.first.c_str());
+    for (const auto &entry : errors)
+    {
+        fprintf(fp, "error %s\t%s\n", entry.first.c_str(),
+                entry.second.c_str());
+    }
+}
+
+static void _merge_worker_stats(FILE *fp)
+{
+    char line[1024];
+    char name[512], text[512];
+    int a, b, c, d;
+    long long ticks;
+    while (fgets(line, sizeof line, fp))
+    {
+        if (sscanf(line, "counts %d %d %d %d", &a, &b, &c, &d) == 4)
+        {
+            levels_tried   += a;
+            levels_failed  += b;
+            build_attempts += c;
+            level_vetoes   += d;
+        }
+        else if (sscanf(line, "try %d %511s", &a, name) == 2)
+            try_count[name] += a;
+        else if (sscanf(line, "use %d %511s", &a, name) == 2)
+            use_count[name] += a;
+        else if (sscanf(line, "time %lld %511s", &ticks, name) == 2)
+            map_build_ticks[name] += ticks;
+        else if (sscanf(line, "builds %d %d %511s", &a, &b, name) == 3)
+        {
+            pair<int, int> &build = map_builds[level_id::parse_level_id(name)];
+            build.first  += a;
+            build.second += b;
+        }
+        else if (sscanf(line, "placed %511s %511s", name, text) == 2)
+        {
+            const level_id lid = level_id::parse_level_id(name);
+            level_mapsused[lid].insert(text);
+            map_levelsused[text].insert(lid);
+        }
+        else if (sscanf(line, "veto %d %511[^\n]", &a, text) == 2)
+            veto_messages[text] += a;
+        else if (sscanf(line, "error %511[^\t]\t%511[^\n]", name, text) == 2)
+            errors[name] = text;
+    }
+}
+
+// Forks the iterations off to the given number of worker processes and
+// merges their tallies back into the parent's tables, from which
+// _write_map_stats() reports as usual. Iterations are independent --
+// each one resets the unique monster and map bookkeeping -- so they
+// partition cleanly; levels within one iteration do not.
+static bool _build_levels_parallel(int jobs)
+{
+    if (jobs > SysEnv.map_gen_iters)
+        jobs = SysEnv.map_gen_iters;
+
+    printf("Forking %d mapstat workers.\n", jobs);
+    fflush(stdout);
+
+    vector<int> fds;
+    vector<pid_t> pids;
+
+    for (int worker = 0; worker < jobs; ++worker)
+    {
+        const int first = SysEnv.map_gen_iters * worker / jobs;
+        const int last  = SysEnv.map_gen_iters * (worker + 1) / jobs;
+
+        int pipefd[2];
+        if (pipe(pipefd))
+        {
+            perror("pipe");
+            return false;
+        }
+
+        const pid_t pid = fork();
+        if (pid < 0)
+        {
+            perror("fork");
+            return false;
+        }
+
+        if (!pid)
+        {
+            close(pipefd[0]);
+            _mapstat_forked = true;
+            _mapstat_worker = worker;
+            // Each worker needs its own dice, or they would all build
+            // the same levels.
+            seed_rng((Options.seed ? Options.seed : (uint32_t) time(nullptr))
+                     + 0x9E3779B9U * (worker + 1));
+            const bool ok = _build_iterations(first, last);
+            FILE *fp = fdopen(pipefd[1], "w");
+            _write_worker_stats(fp);
+            fclose(fp);
+            _exit(ok ? 0 : 1);
+        }
+
+        close(pipefd[1]);
+        fds.push_back(pipefd[0]);
+        pids.push_back(pid);
+    }
+
+    // Drain each worker's pipe before waiting on it, so a worker whose
+    // stats exceed the pipe buffer can finish writing.
+    bool success = true;
+    for (int worker = 0; worker < jobs; ++worker)
+    {
+        FILE *fp = fdopen(fds[worker], "r");
+        _merge_worker_stats(fp);
+        fclose(fp);
+
+        int status = 0;
+        if (waitpid(pids[worker], &status, 0) != pids[worker]
+            || !WIFEXITED(status) || WEXITSTATUS(status))
+        {
+            success = false;
+        }
+    }
+
+    if (success)
+    {
+        printf("Finished.\n");
+        fflush(stdout);
+    }
+    return success;
+}
+#endif // UNIX
+
+bool mapstat_build_levels()
+{
+    if (!generated_levels.size())
+        _dungeon_places();
+
+#ifdef UNIX
+    // Workers apply to mapstat proper only: objstat keeps separate
+    // tallies that aren't merged here.
+    if (SysEnv.map_gen_jobs > 1 && !crawl_state.obj_stat_gen)
+        return _build_levels_parallel(SysEnv.map_gen_jobs);
+#endif
+
+    printf("Iteration: ");
+    fflush(stdout);
+    if (!_build_iterations(0, SysEnv.map_gen_iters))
+        return false;
     printf("Finished.\n");
     fflush(stdout);
     return true;
@@ -278,6 +483,11 @@ void mapstat_report_map_try(const map_def &map)
     try_count[map.name]++;
 }
 
+void mapstat_report_map_time(const map_def &map, int64_t ticks)
+{
+    map_build_ticks[map.name] += ticks;
+}
+
 void mapstat_report_map_use(const map_def &map)
 {
     use_count[map.name]++;
@@ -451,6 +661,24 @@ static void _write_map_stats()
             fprintf(outf, "%4d (%4d): %s\n", uses, tries, entry.second.c_str());
     }
 
+    if (!map_build_ticks.empty())
+    {
+        fprintf(outf, "\n\nSlowest maps (by total build time):\n\n");
+        multimap<int64_t, string> sortedtimes;
+        for (const auto &entry : map_build_ticks)
+            sortedtimes.insert(make_pair(entry.second, entry.first));
+
+        int count = 0;
+        for (auto i = sortedtimes.rbegin();
+             i != sortedtimes.rend() && count < 50; ++i)
+        {
+            const double secs = (double) i->first / CLOCKS_PER_SEC;
+            const int tries = lookup(try_count, i->second, 0);
+            fprintf(outf, "%3d) %8.2fs over %5d tries: %s\n",
+                    ++count, secs, tries, i->second.c_str());
+        }
+    }
+
     fprintf(outf, "\n\nMaps and where used:\n\n");
     for (const auto &entry : map_levelsused)
     {
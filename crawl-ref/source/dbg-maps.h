@@ -10,6 +10,7 @@
 
 class map_def;
 void mapstat_report_map_try(const map_def &map);
+void mapstat_report_map_time(const map_def &map, int64_t ticks);
 void mapstat_report_map_use(const map_def &map);
 void mapstat_report_error(const map_def &map, const string &err);
 void mapstat_report_map_build_start();
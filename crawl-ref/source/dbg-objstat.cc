@@ -94,8 +94,35 @@ static map<branch_type, vector<level_id> > stat_branches;
 static int num_branches = 0;
 static int num_levels = 0;
 
-// item_recs[level_id][item.base_type][item.sub_type][field]
-static map<level_id, vector< vector< map<string, double> > > > item_recs;
+// Field names are interned to dense indices once, and the per-type
+// records are flat vectors of doubles instead of string-keyed maps:
+// large iteration counts were spending their time (and most of their
+// memory) on the map nodes and string comparisons.
+typedef vector<double> stat_rec;
+
+static map<string, int> field_indices;
+
+static int _field_index(const string &field)
+{
+    return field_indices.insert(make_pair(field,
+                                          (int)field_indices.size()))
+        .first->second;
+}
+
+static double &_stat(stat_rec &stats, int findex)
+{
+    if ((int)stats.size() <= findex)
+        stats.resize(findex + 1, 0);
+    return stats[findex];
+}
+
+static double &_stat(stat_rec &stats, const string &field)
+{
+    return _stat(stats, _field_index(field));
+}
+
+// item_recs[level_id][item.base_type][item.sub_type][field index]
+static map<level_id, vector< vector< stat_rec > > > item_recs;
 
 // weapon_brands[level_id][item.base_type][item.sub_type][antiquity_level][brand];
 typedef map<level_id, vector< vector< vector< int> > > > brand_records;
@@ -183,7 +210,7 @@ static const vector<string> monster_fields = {
 };
 
 static map<monster_type, int> valid_monsters;
-static map<level_id, map<int, map <string, double> > > monster_recs;
+static map<level_id, map<int, stat_rec> > monster_recs;
 
 static void _init_monsters()
 {
@@ -470,12 +497,13 @@ static void _init_stats()
                 for (int  j = 0; j < num_entries; j++)
                 {
                     item_recs[lev][i].emplace_back();
+                    stat_rec &stats = item_recs[lev][i][j];
                     for (const string &field : item_fields[i])
-                        item_recs[lev][i][j][field] = 0;
+                        _stat(stats, field) = 0;
                     // For determining the NumSD, NumMin and NumMax fields.
-                    item_recs[lev][i][j]["NumForIter"] = 0;
-                    item_recs[lev][i][j][min_field] = INFINITY;
-                    item_recs[lev][i][j][max_field] = -1;
+                    _stat(stats, "NumForIter") = 0;
+                    _stat(stats, min_field) = INFINITY;
+                    _stat(stats, max_field) = -1;
                 }
             }
             weapon_brands[lev] = { };
@@ -498,33 +526,40 @@ static void _init_stats()
 
             for (const auto &mentry : valid_monsters)
             {
+                stat_rec &stats = monster_recs[lev][mentry.second];
                 for (const string &field : monster_fields)
-                    monster_recs[lev][mentry.second][field] = 0;
+                    _stat(stats, field) = 0;
                 // For determining the NumMin and NumMax fields.
-                monster_recs[lev][mentry.second]["NumForIter"] = 0;
-                monster_recs[lev][mentry.second]["NumMin"] = INFINITY;
-                monster_recs[lev][mentry.second]["NumMax"] = -1;
+                _stat(stats, "NumForIter") = 0;
+                _stat(stats, "NumMin") = INFINITY;
+                _stat(stats, "NumMax") = -1;
             }
         }
     }
 }
 
 static void _record_item_stat(const level_id &lev, const item_type &item,
-                              string field, double value)
+                              const string &field, double value)
 {
+    // Resolve the field once; all six increments below are then plain
+    // array bumps.
+    const int findex = _field_index(field);
     int class_sum = _item_max_sub_type(item.base_type);
     level_id br_lev(lev.branch, -1);
 
-    item_recs[lev][item.base_type][item.sub_type][field] += value;
+    vector<stat_rec> &cur = item_recs[lev][item.base_type];
+    vector<stat_rec> &br  = item_recs[br_lev][item.base_type];
+    vector<stat_rec> &all = item_recs[all_lev][item.base_type];
 
-    item_recs[br_lev][item.base_type][item.sub_type][field] += value;
-    item_recs[all_lev][item.base_type][item.sub_type][field] += value;
+    _stat(cur[item.sub_type], findex) += value;
+    _stat(br[item.sub_type], findex) += value;
+    _stat(all[item.sub_type], findex) += value;
     // Only record a class summary if more than one subtype exists
     if (class_sum > 1)
     {
-        item_recs[lev][item.base_type][class_sum][field] += value;
-        item_recs[br_lev][item.base_type][class_sum][field] += value;
-        item_recs[all_lev][item.base_type][class_sum][field] += value;
+        _stat(cur[class_sum], findex) += value;
+        _stat(br[class_sum], findex) += value;
+        _stat(all[class_sum], findex) += value;
     }
 }
 
@@ -769,18 +804,23 @@ void objstat_record_item(const item_def &item)
     _record_item_stat(cur_lev, itype, "NumForIter", item.quantity);
 }
 
-static void _record_monster_stat(const level_id &lev, int mons_ind, string field,
-                                 double value)
+static void _record_monster_stat(const level_id &lev, int mons_ind,
+                                 const string &field, double value)
 {
+    const int findex = _field_index(field);
     const level_id br_lev(lev.branch, -1);
     const int sum_ind = valid_monsters[NUM_MONSTERS];
 
-    monster_recs[lev][mons_ind][field] += value;
-    monster_recs[lev][sum_ind][field] += value;
-    monster_recs[br_lev][mons_ind][field] += value;
-    monster_recs[br_lev][sum_ind][field] += value;
-    monster_recs[all_lev][mons_ind][field] += value;
-    monster_recs[all_lev][sum_ind][field] += value;
+    map<int, stat_rec> &cur = monster_recs[lev];
+    map<int, stat_rec> &br  = monster_recs[br_lev];
+    map<int, stat_rec> &all = monster_recs[all_lev];
+
+    _stat(cur[mons_ind], findex) += value;
+    _stat(cur[sum_ind], findex) += value;
+    _stat(br[mons_ind], findex) += value;
+    _stat(br[sum_ind], findex) += value;
+    _stat(all[mons_ind], findex) += value;
+    _stat(all[sum_ind], findex) += value;
 }
 
 void objstat_record_monster(const monster *mons)
@@ -853,25 +893,27 @@ void objstat_iteration_stats()
                     string min_f = use_all ? "AllNumMin" : "NumMin";
                     string max_f = use_all ? "AllNumMax" : "NumMax";
                     string sd_f = use_all ? "AllNumSD" : "NumSD";
-                    map<string, double> &stats = item_recs[lev][i][j];
-                    if (stats["NumForIter"] > stats[max_f])
-                        stats[max_f] = stats["NumForIter"];
-                    if (stats["NumForIter"] < stats[min_f])
-                        stats[min_f] = stats["NumForIter"];
-                    stats[sd_f] += stats["NumForIter"] * stats["NumForIter"];
-                    stats["NumForIter"] = 0;
+                    stat_rec &stats = item_recs[lev][i][j];
+                    const double iter = _stat(stats, "NumForIter");
+                    if (iter > _stat(stats, max_f))
+                        _stat(stats, max_f) = iter;
+                    if (iter < _stat(stats, min_f))
+                        _stat(stats, min_f) = iter;
+                    _stat(stats, sd_f) += iter * iter;
+                    _stat(stats, "NumForIter") = 0;
                 }
             }
 
             for (const auto &mentry : valid_monsters)
             {
-                map<string, double> &stats = monster_recs[lev][mentry.second];
-                if (stats["NumForIter"] > stats["NumMax"])
-                    stats["NumMax"] = stats["NumForIter"];
-                if (stats["NumForIter"] < stats["NumMin"])
-                    stats["NumMin"] = stats["NumForIter"];
-                stats["NumSD"] += stats["NumForIter"] * stats["NumForIter"];
-                stats["NumForIter"] = 0;
+                stat_rec &stats = monster_recs[lev][mentry.second];
+                const double iter = _stat(stats, "NumForIter");
+                if (iter > _stat(stats, "NumMax"))
+                    _stat(stats, "NumMax") = iter;
+                if (iter < _stat(stats, "NumMin"))
+                    _stat(stats, "NumMin") = iter;
+                _stat(stats, "NumSD") += iter * iter;
+                _stat(stats, "NumForIter") = 0;
             }
         }
     }
@@ -885,7 +927,7 @@ static void _write_stat_headers(const vector<string> &fields, bool items = true)
     fprintf(stat_outf, "\n");
 }
 
-static void _write_stat(map<string, double> &stats, string field)
+static void _write_stat(stat_rec &stats, const string &field)
 {
     ostringstream output;
     double value = 0;
@@ -893,7 +935,7 @@ static void _write_stat(map<string, double> &stats, string field)
     output.precision(STAT_PRECISION);
     output.setf(ios_base::fixed);
     if (field == "PileQuant")
-        value = stats["Num"] / stats["NumPiles"];
+        value = _stat(stats, "Num") / _stat(stats, "NumPiles");
     else if (field == "WandCharges"
              || field == "RodMana"
              || field == "RodRecharge"
@@ -903,14 +945,14 @@ static void _write_stat(map<string, double> &stats, string field)
              || field == "MonsXP"
              || field == "MonsNumChunks")
     {
-        value = stats[field] / stats["Num"];
+        value = _stat(stats, field) / _stat(stats, "Num");
     }
     else if (field == "AllEnch" || field == "AllDeckCards")
-        value = stats[field] / stats["AllNum"];
+        value = _stat(stats, field) / _stat(stats, "AllNum");
     else if (field == "ArteEnch")
-        value = stats[field] / stats["ArteNum"];
+        value = _stat(stats, field) / _stat(stats, "ArteNum");
     else if (field == "OrdEnch")
-        value = stats[field] / stats["OrdNum"];
+        value = _stat(stats, field) / _stat(stats, "OrdNum");
     else if (field == "NumSD" || field == "AllNumSD")
     {
         const string num_f = field == "NumSD" ? "Num" : "AllNum";
@@ -918,18 +960,19 @@ static void _write_stat(map<string, double> &stats, string field)
             value = 0;
         else
         {
-            const double mean = stats[num_f] / SysEnv.map_gen_iters;
+            const double mean = _stat(stats, num_f) / SysEnv.map_gen_iters;
             value = sqrt((SysEnv.map_gen_iters / (SysEnv.map_gen_iters - 1.0))
-                         * (stats[field] / SysEnv.map_gen_iters - mean * mean));
+                         * (_stat(stats, field) / SysEnv.map_gen_iters
+                            - mean * mean));
         }
     }
     else if (field == "NumMin" || field == "AllNumMin" || field == "NumMax"
              || field == "AllNumMax")
     {
-        value = stats[field];
+        value = _stat(stats, field);
     }
     else
-        value = stats[field] / SysEnv.map_gen_iters;
+        value = _stat(stats, field) / SysEnv.map_gen_iters;
     output << "\t" << value;
     fprintf(stat_outf, "%s", output.str().c_str());
 }
@@ -1062,21 +1105,18 @@ static void _write_branch_item_stats(branch_type br, const item_type &item)
     for (level_id lid : stat_branches[br])
     {
         ++level_count;
-        if (item_recs[lid][item.base_type][item.sub_type][num_field] < 1)
+        stat_rec &item_stats = item_recs[lid][item.base_type][item.sub_type];
+        if (_stat(item_stats, num_field) < 1)
             continue;
         fprintf(stat_outf, "%s\t%s", name.c_str(), _level_name(lid).c_str());
-        map <string, double> &item_stats =
-            item_recs[lid][item.base_type][item.sub_type];
         for (const string &field : fields)
             _write_stat(item_stats, field);
         _write_level_brand_stats(lid, item);
         fprintf(stat_outf, "\n");
     }
-    if (level_count > 1
-        && item_recs[br_lev][item.base_type][item.sub_type][num_field] > 0)
+    stat_rec &branch_stats = item_recs[br_lev][item.base_type][item.sub_type];
+    if (level_count > 1 && _stat(branch_stats, num_field) > 0)
     {
-        map <string, double> &branch_stats =
-            item_recs[br_lev][item.base_type][item.sub_type];
         fprintf(stat_outf, "%s\t%s", name.c_str(), _level_name(br_lev).c_str());
         for (const string &field : fields)
             _write_stat(branch_stats, field);
@@ -1100,7 +1140,7 @@ static void _write_branch_monster_stats(branch_type br, monster_type mons_type,
     for (level_id lid : stat_branches[br])
     {
         ++level_count;
-        if (monster_recs[lid][mons_ind]["Num"] < 1)
+        if (_stat(monster_recs[lid][mons_ind], "Num") < 1)
             continue;
         fprintf(stat_outf, "%s\t%s", mons_name.c_str(),
                 _level_name(lid).c_str());
@@ -1109,7 +1149,7 @@ static void _write_branch_monster_stats(branch_type br, monster_type mons_type,
         fprintf(stat_outf, "\n");
     }
     // If there are multiple levels for this branch, print a branch summary.
-    if (level_count > 1 && monster_recs[br_lev][mons_ind]["Num"] > 0)
+    if (level_count > 1 && _stat(monster_recs[br_lev][mons_ind], "Num") > 0)
     {
         fprintf(stat_outf, "%s\t%s", mons_name.c_str(),
                 _level_name(br_lev).c_str());
@@ -0,0 +1,282 @@
+/**
+ * @file
+ * @brief Wall-clock timing of the phases of recent turns.
+ *
+ * world_reacts() wraps its expensive phases in prof_phase timers; the
+ * per-phase totals of the last PROF_HISTORY turns are kept in a ring
+ * buffer, so a slow turn can be attributed after the fact without
+ * rerunning the game under an external profiler.  The &Ctrl-L wizard
+ * command prints a summary, and -profile-turns <file> streams one CSV
+ * row per turn for offline analysis.
+ *
+ * Builds made with -DDEBUG_ALLOCATIONS additionally wrap the global
+ * operator new/delete to histogram heap allocations by size class and
+ * by the phase active when they happened; &Ctrl-L prints those too.
+**/
+
+#include "AppHdr.h"
+
+#include "dbg-prof.h"
+
+#include "end.h"
+#include "libutil.h"
+#include "message.h"
+#include "player.h"
+#include "syscalls.h"
+
+#ifdef TARGET_OS_WINDOWS
+# include "windows.h"
+#else
+# include <sys/time.h>
+#endif
+
+#ifdef DEBUG_ALLOCATIONS
+# include <new>
+#endif
+
+// Keep in sync with prof_phase_type.
+static const char *_phase_names[NUM_PROF_PHASES] =
+{
+    "player", "monsters", "time_effects", "clouds", "view", "other",
+};
+
+static int64_t _now_micros()
+{
+#ifdef TARGET_OS_WINDOWS
+    // MSVC has no gettimeofday(); FILETIME counts 100ns units.
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+    uint64_t tt = ft.dwHighDateTime;
+    tt <<= 32;
+    tt |= ft.dwLowDateTime;
+    return (int64_t)(tt / 10);
+#else
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+int64_t prof_time_micros()
+{
+    return _now_micros();
+}
+
+struct turn_times
+{
+    int turn;
+    int micros[NUM_PROF_PHASES];
+    int total;
+};
+
+static const int PROF_HISTORY = 256;
+static turn_times _history[PROF_HISTORY];
+static int _hist_used = 0;
+static int _hist_next = 0;
+
+// Accumulators for the turn currently being timed.  Phases can run
+// more than once per turn (or not at all), so sum rather than assign.
+static bool _turn_active = false;
+static int64_t _turn_start = 0;
+static int _accum[NUM_PROF_PHASES];
+
+static FILE *_csv = nullptr;
+
+// The innermost phase currently on the stack; NUM_PROF_PHASES while no
+// phase is being timed (startup, input, interlevel travel, ...).  Used
+// by the DEBUG_ALLOCATIONS machinery to attribute heap traffic.
+static prof_phase_type _active_phase = NUM_PROF_PHASES;
+
+prof_phase::prof_phase(prof_phase_type ph)
+    : phase(ph), prev(_active_phase), start(_now_micros())
+{
+    _active_phase = ph;
+}
+
+prof_phase::~prof_phase()
+{
+    _active_phase = prev;
+    if (_turn_active)
+        _accum[phase] += (int)(_now_micros() - start);
+}
+
+void prof_turn_start()
+{
+    _turn_start = _now_micros();
+    _turn_active = true;
+    for (int i = 0; i < NUM_PROF_PHASES; ++i)
+        _accum[i] = 0;
+}
+
+void prof_turn_end()
+{
+    if (!_turn_active)
+        return;
+    _turn_active = false;
+
+    const int total = (int)(_now_micros() - _turn_start);
+    int accounted = 0;
+    for (int i = 0; i < PROF_OTHER; ++i)
+        accounted += _accum[i];
+    _accum[PROF_OTHER] = max(0, total - accounted);
+
+    turn_times &rec = _history[_hist_next];
+    rec.turn = you.num_turns;
+    for (int i = 0; i < NUM_PROF_PHASES; ++i)
+        rec.micros[i] = _accum[i];
+    rec.total = total;
+
+    _hist_next = (_hist_next + 1) % PROF_HISTORY;
+    if (_hist_used < PROF_HISTORY)
+        _hist_used++;
+
+    if (_csv)
+    {
+        fprintf(_csv, "%d", rec.turn);
+        for (int i = 0; i < NUM_PROF_PHASES; ++i)
+            fprintf(_csv, ",%d", rec.micros[i]);
+        fprintf(_csv, ",%d\n", rec.total);
+        // One line per turn; flush so a crash doesn't eat the evidence.
+        fflush(_csv);
+    }
+}
+
+void prof_start_csv(const char *filename)
+{
+    if (_csv)
+        fclose(_csv);
+    _csv = fopen_u(filename, "w");
+    if (!_csv)
+    {
+        fprintf(stderr, "Can't write turn profile to %s\n", filename);
+        end(1);
+    }
+
+    fprintf(_csv, "turn");
+    for (int i = 0; i < NUM_PROF_PHASES; ++i)
+        fprintf(_csv, ",%s", _phase_names[i]);
+    fprintf(_csv, ",total\n");
+}
+
+#ifdef DEBUG_ALLOCATIONS
+
+// Power-of-two size classes: bucket 0 is <= 16 bytes, each bucket after
+// that doubles, and the last one catches everything >= 512KB.
+static const int ALLOC_BUCKETS = 16;
+
+// One extra phase slot for allocations made outside any timed phase.
+static uint64_t _alloc_count[NUM_PROF_PHASES + 1][ALLOC_BUCKETS];
+static uint64_t _alloc_bytes[NUM_PROF_PHASES + 1];
+static uint64_t _free_count[NUM_PROF_PHASES + 1];
+
+static int _alloc_bucket(size_t size)
+{
+    int bucket = 0;
+    for (size_t cap = 16; cap < size && bucket < ALLOC_BUCKETS - 1; cap *= 2)
+        bucket++;
+    return bucket;
+}
+
+static void _record_alloc(size_t size)
+{
+    _alloc_count[_active_phase][_alloc_bucket(size)]++;
+    _alloc_bytes[_active_phase] += size;
+}
+
+// Not thread-safe, but neither is the rest of Crawl.
+void *operator new(size_t size)
+{
+    void *ptr = malloc(size);
+    if (!ptr)
+        throw std::bad_alloc();
+    _record_alloc(size);
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (ptr)
+    {
+        _free_count[_active_phase]++;
+        free(ptr);
+    }
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+static void _debug_alloc_profile()
+{
+    mprf(MSGCH_DIAGNOSTICS,
+         "Heap allocations by phase since startup (count/frees/bytes):");
+    for (int i = 0; i <= NUM_PROF_PHASES; ++i)
+    {
+        uint64_t count = 0;
+        for (int b = 0; b < ALLOC_BUCKETS; ++b)
+            count += _alloc_count[i][b];
+        if (!count && !_free_count[i])
+            continue;
+        mprf(MSGCH_DIAGNOSTICS, "%-12s %10" PRIu64 " %10" PRIu64 " %12" PRIu64,
+             i == NUM_PROF_PHASES ? "outside" : _phase_names[i],
+             count, _free_count[i], _alloc_bytes[i]);
+    }
+
+    mprf(MSGCH_DIAGNOSTICS, "Allocation size classes (all phases):");
+    size_t cap = 16;
+    for (int b = 0; b < ALLOC_BUCKETS; ++b, cap *= 2)
+    {
+        uint64_t count = 0;
+        for (int i = 0; i <= NUM_PROF_PHASES; ++i)
+            count += _alloc_count[i][b];
+        if (count)
+        {
+            mprf(MSGCH_DIAGNOSTICS, "%s %7d bytes: %10" PRIu64,
+                 b == ALLOC_BUCKETS - 1 ? "> " : "<=",
+                 (int)(b == ALLOC_BUCKETS - 1 ? cap / 2 : cap), count);
+        }
+    }
+}
+#endif // DEBUG_ALLOCATIONS
+
+void debug_turn_profile()
+{
+    if (!_hist_used)
+        mpr("No turns have been timed yet.");
+    else
+    {
+        const turn_times &last =
+            _history[(_hist_next + PROF_HISTORY - 1) % PROF_HISTORY];
+
+        mprf(MSGCH_DIAGNOSTICS,
+             "world_reacts() times over the last %d turns, in microseconds:",
+             _hist_used);
+        for (int i = 0; i <= NUM_PROF_PHASES; ++i)
+        {
+            int64_t sum = 0;
+            int peak = 0;
+            for (int j = 0; j < _hist_used; ++j)
+            {
+                const int val = i == NUM_PROF_PHASES ? _history[j].total
+                                                     : _history[j].micros[i];
+                sum += val;
+                peak = max(peak, val);
+            }
+            const int cur = i == NUM_PROF_PHASES ? last.total
+                                                 : last.micros[i];
+            mprf(MSGCH_DIAGNOSTICS, "%-12s last %7d  mean %7d  max %7d",
+                 i == NUM_PROF_PHASES ? "total" : _phase_names[i],
+                 cur, (int)(sum / _hist_used), peak);
+        }
+    }
+
+#ifdef DEBUG_ALLOCATIONS
+    _debug_alloc_profile();
+#endif
+}
@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @brief Wall-clock timing of the phases of recent turns.
+**/
+
+#ifndef DBGPROF_H
+#define DBGPROF_H
+
+// Keep _phase_names in dbg-prof.cc in sync with this.
+enum prof_phase_type
+{
+    PROF_PLAYER,       // player_reacts()
+    PROF_MONSTERS,     // handle_monsters()
+    PROF_TIME_EFFECTS, // handle_time()
+    PROF_CLOUDS,       // manage_clouds()
+    PROF_VIEW,         // the end-of-turn viewwindow()
+    PROF_OTHER,        // whatever is left of the turn
+    NUM_PROF_PHASES
+};
+
+// Scoped timer: charges the time between construction and destruction
+// to the given phase of the current turn.
+class prof_phase
+{
+public:
+    prof_phase(prof_phase_type ph);
+    ~prof_phase();
+private:
+    prof_phase_type phase;
+    prof_phase_type prev;
+    int64_t start;
+};
+
+void prof_turn_start();
+void prof_turn_end();
+
+// The profiler's clock, for callers timing larger spans of work.
+int64_t prof_time_micros();
+
+void prof_start_csv(const char *filename);
+
+void debug_turn_profile();
+
+#endif
@@ -467,12 +467,13 @@ static card_type _choose_from_archetype(const deck_archetype* pdeck,
 
     int totalweight = 0;
     card_type result = NUM_CARDS;
-    for (const card_with_weights cww : *pdeck)
+    for (const card_with_weights& cww : *pdeck)
     {
         if (_card_forbidden(cww.card))
             continue;
-        totalweight += cww.weight[rarity - DECK_RARITY_COMMON];
-        if (x_chance_in_y(cww.weight[rarity - DECK_RARITY_COMMON], totalweight))
+        const int weight = cww.weight[rarity - DECK_RARITY_COMMON];
+        totalweight += weight;
+        if (x_chance_in_y(weight, totalweight))
             result = cww.card;
     }
     return result;
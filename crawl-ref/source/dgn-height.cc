@@ -63,21 +63,29 @@ void dgn_smooth_height_at(coord_def c, int radius, int max_height)
     if (max_height != DGN_UNDEFINED_HEIGHT && height > max_height)
         return;
 
+    grid_heightmap &heights(*env.heightmap);
+
+    // Clamp the window to the map bounds up front so the inner loop can
+    // sweep each row without a bounds check per square. This runs for
+    // every grid square (several times over) when smoothing Shoals and
+    // Swamp heightmaps.
+    const int x1 = max(c.x - radius, X_BOUND_1 + 1);
+    const int x2 = min(c.x + radius, X_BOUND_2 - 1);
+    const int y1 = max(c.y - radius, Y_BOUND_1 + 1);
+    const int y2 = min(c.y + radius, Y_BOUND_2 - 1);
+
     const int max_delta = radius * radius * 2 + 2;
     int divisor = 0;
     int total = 0;
-    for (int y = c.y - radius; y <= c.y + radius; ++y)
+    for (int y = y1; y <= y2; ++y)
     {
-        for (int x = c.x - radius; x <= c.x + radius; ++x)
+        const int row_delta = max_delta - (y - c.y) * (y - c.y);
+        for (int x = x1; x <= x2; ++x)
         {
-            const coord_def p(x, y);
-            if (!in_bounds(p))
-                continue;
-            const int nheight = dgn_height_at(p);
+            const int nheight = heights[x][y];
             if (max_height != DGN_UNDEFINED_HEIGHT && nheight > max_height)
                 continue;
-            const coord_def off = c - p;
-            const int weight = max_delta - off.abs();
+            const int weight = row_delta - (x - c.x) * (x - c.x);
             divisor += weight;
             total += nheight * weight;
         }
@@ -391,18 +391,15 @@ static string _print_altars_for_gods(const vector<god_type>& gods,
     char const *colour;
     const int columns = 4;
 
+    // Note which gods have a seen altar in one pass, rather than
+    // rescanning the altar list once per god.
+    bool seen_altar[NUM_GODS] = { false };
+    for (const auto &entry : altars_present)
+        seen_altar[entry.second] = true;
+
     for (const god_type god : gods)
     {
-        // for each god, look through the notable altars list for a match
-        bool has_altar_been_seen = false;
-        for (const auto &entry : altars_present)
-        {
-            if (entry.second == god)
-            {
-                has_altar_been_seen = true;
-                break;
-            }
-        }
+        const bool has_altar_been_seen = seen_altar[god];
 
         // If dumping, only laundry list the seen gods
         if (!display)
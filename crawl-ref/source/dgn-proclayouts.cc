@@ -91,7 +91,7 @@ WorleyLayout::operator()(const coord_def &p, const uint32_t offset) const
 ProceduralSample
 ChaosLayout::operator()(const coord_def &p, const uint32_t offset) const
 {
-    uint64_t base = hash3(p.x, p.y, seed);
+    uint64_t base = hash_coord(p, seed);
     uint32_t density = baseDensity + seed % 50 + (seed >> 16) % 60;
     if ((base % 1000) < density)
         return ProceduralSample(p, _pick_pseudorandom_wall(base/3), offset + 4096);
@@ -141,7 +141,7 @@ RiverLayout::operator()(const coord_def &p, const uint32_t offset) const
     if (delta < 1.5/scalar)
     {
         dungeon_feature_type feat = DNGN_SHALLOW_WATER;
-        uint64_t hash = hash3(p.x, p.y, n.id[0] + seed);
+        uint64_t hash = hash_coord(p, n.id[0] + seed);
         if (!(hash % 5))
             feat = DNGN_DEEP_WATER;
         if (!(hash % 23))
@@ -155,7 +155,7 @@ ProceduralSample
 NewAbyssLayout::operator()(const coord_def &p, const uint32_t offset) const
 {
     const double scale = 1.0 / 3.2;
-    uint64_t base = hash3(p.x, p.y, seed);
+    uint64_t base = hash_coord(p, seed);
     worley::noise_datum noise = worley::noise(
             p.x * scale,
             p.y * scale,
@@ -241,7 +241,7 @@ LevelLayout::LevelLayout(level_id id, uint32_t _seed, const ProceduralLayout &_l
         for (adjacent_iterator ai(*ri); ai; ++ai)
             solid_count += cell_is_solid(*ai);
         coord_def p = *ri;
-        uint64_t base = hash3(p.x, p.y, seed);
+        uint64_t base = hash_coord(p, seed);
         int div = base % 2 ? 12 : 11;
         switch (solid_count)
         {
@@ -327,7 +327,7 @@ ProceduralSample
 ClampLayout::operator()(const coord_def &p, const uint32_t offset) const
 {
     uint32_t cycle = offset / clamp;
-    uint32_t order = hash3(p.x, p.y, 0xDEADBEEF + cycle);
+    uint32_t order = hash_coord(p, 0xDEADBEEF + cycle);
     if (bursty)
         order &= hash3(p.x + 31, p.y - 37, 0x0DEFACED + cycle);
     order %= clamp;
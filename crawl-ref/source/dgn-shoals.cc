@@ -912,16 +912,60 @@ static vector<coord_def> _shoals_extra_tide_seeds()
     return find_marker_positions_by_prop("tide_seed");
 }
 
+// The shoreline band: cells whose height is close enough to the
+// waterline that the tide (even a full called tide) can ever flood or
+// drain them. Everything below the band is permanent ocean, everything
+// above it is permanently dry; neither needs to be visited when a tide
+// is applied.
+static bool _shoals_in_tide_band(int height)
+{
+    return height >= SHT_SHALLOW_WATER + LOW_TIDE / TIDE_MULTIPLIER
+           && height <= HIGH_TIDE / TIDE_MULTIPLIER + HIGH_CALLED_TIDE;
+}
+
+// Band cells that are under water at any tide; the tide sweeps into the
+// band from these, so they seed the flood fill in place of the old
+// whole-ocean walk from the map corners.
+static bool _shoals_tide_always_wet(int height)
+{
+    return height < LOW_TIDE / TIDE_MULTIPLIER;
+}
+
+static vector<coord_def> _tide_band_seeds;
+static FixedArray<bool, GXM, GYM> _tide_band(false);
+static level_id _tide_band_level;
+
+// The heightmap is fixed once a level has finished generating, so the
+// shoreline band is indexed just once per level.
+static void _shoals_refresh_tide_band()
+{
+    const level_id here = level_id::current();
+    if (here == _tide_band_level && !crawl_state.generating_level)
+        return;
+
+    _tide_band_seeds.clear();
+    _tide_band.init(false);
+    for (rectangle_iterator ri(1); ri; ++ri)
+    {
+        const int height = dgn_height_at(*ri);
+        if (!_shoals_in_tide_band(height))
+            continue;
+        _tide_band(*ri) = true;
+        if (_shoals_tide_always_wet(height))
+            _tide_band_seeds.push_back(*ri);
+    }
+    _tide_band_level = here;
+}
+
 static void _shoals_apply_tide(int tide, bool incremental_tide)
 {
+    _shoals_refresh_tide_band();
+
     vector<coord_def> pages[2];
     int current_page = 0;
 
-    // Start from corners of the map.
-    pages[current_page].emplace_back(1,1);
-    pages[current_page].emplace_back(GXM - 2, 1);
-    pages[current_page].emplace_back(1, GYM - 2);
-    pages[current_page].emplace_back(GXM - 2, GYM - 2);
+    // Start from the permanently wet fringe of the shoreline band.
+    pages[current_page] = _tide_band_seeds;
 
     // Find any extra seeds -- markers with tide_seed="y".
     const vector<coord_def> extra_seeds(_shoals_extra_tide_seeds());
@@ -965,8 +1009,9 @@ static void _shoals_apply_tide(int tide, bool incremental_tide)
                     if (!seen_points(adj))
                     {
                         const dungeon_feature_type feat = grd(adj);
-                        if (_shoals_tide_passable_feat(feat)
-                            || _shoals_tide_susceptible_feat(feat))
+                        if (_tide_band(adj)
+                            && (_shoals_tide_passable_feat(feat)
+                                || _shoals_tide_susceptible_feat(feat)))
                         {
                             npage.push_back(adj);
                             seen_points(adj) = true;
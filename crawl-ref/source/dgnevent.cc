@@ -53,6 +53,13 @@ bool dgn_event_dispatcher::fire_vetoable_position_event(
     dgn_square_alarm *alarm = grid_triggers[pos.x][pos.y].get();
     if (alarm && (alarm->eventmask & et.type))
     {
+        // The copy lets listeners deregister themselves from this cell
+        // mid-notification.  With a single listener - the usual case -
+        // notifying through a grabbed pointer is just as safe and
+        // skips the allocation.
+        if (alarm->listeners.size() == 1)
+            return alarm->listeners.front()->notify_dgn_event(et);
+
         dgn_square_alarm alcopy(*alarm);
         for (auto listener : alcopy.listeners)
             if (!listener->notify_dgn_event(et))
@@ -74,6 +81,13 @@ void dgn_event_dispatcher::fire_position_event(
     dgn_square_alarm *alarm = grid_triggers[pos.x][pos.y].get();
     if (alarm && (alarm->eventmask & et.type))
     {
+        // See fire_vetoable_position_event about the copy.
+        if (alarm->listeners.size() == 1)
+        {
+            alarm->listeners.front()->notify_dgn_event(et);
+            return;
+        }
+
         dgn_square_alarm alcopy = *alarm;
         for (auto listener : alcopy.listeners)
             listener->notify_dgn_event(et);
@@ -1640,6 +1640,26 @@ bool direction_chooser::select_compass_direction(const coord_def& delta)
     }
 }
 
+// Like find_ray() from you.pos(), but memoised per target: nothing on the
+// level can change while the targeting prompt is up, so a cell the cursor
+// has already crossed doesn't need its quadrant search re-run.
+bool direction_chooser::find_ray_to(const coord_def& trg, ray_def& r)
+{
+    map<coord_def, pair<bool, ray_def> >::const_iterator found
+        = ray_memo.find(trg);
+    if (found != ray_memo.end())
+    {
+        if (found->second.first)
+            r = found->second.second;
+        return found->second.first;
+    }
+
+    const bool success = find_ray(you.pos(), trg, r, opc_solid_see,
+                                  you.current_vision);
+    ray_memo[trg] = make_pair(success, r);
+    return success;
+}
+
 void direction_chooser::toggle_beam()
 {
     if (!needs_path)
@@ -1652,10 +1672,7 @@ void direction_chooser::toggle_beam()
     need_beam_redraw = true;
 
     if (show_beam)
-    {
-        have_beam = find_ray(you.pos(), target(), beam,
-                             opc_solid_see, you.current_vision);
-    }
+        have_beam = find_ray_to(target(), beam);
 }
 
 bool direction_chooser::select_previous_target()
@@ -1706,6 +1723,10 @@ void direction_chooser::handle_wizard_command(command_type key_command,
     if (!you.wizard)
         return;
 
+    // Several of these can alter the level (miscasts knocking down walls,
+    // moving the player...), so don't trust previously found rays.
+    ray_memo.clear();
+
     monster* const m = monster_at(target());
     string marker_result = "";
 
@@ -2053,8 +2074,7 @@ bool direction_chooser::do_main_loop()
     // Redraw whatever is necessary.
     if (old_target != target())
     {
-        have_beam = show_beam && find_ray(you.pos(), target(), beam,
-                                          opc_solid_see, you.current_vision);
+        have_beam = show_beam && find_ray_to(target(), beam);
         need_text_redraw   = true;
         need_beam_redraw   = true;
         need_cursor_redraw = true;
@@ -2113,8 +2133,7 @@ bool direction_chooser::choose_direction()
     // If requested, show the beam on startup.
     if (show_beam)
     {
-        have_beam = find_ray(you.pos(), target(), beam,
-                             opc_solid_see, you.current_vision);
+        have_beam = find_ray_to(target(), beam);
         need_beam_redraw = have_beam;
     }
     if (hitfunc)
@@ -3053,7 +3072,7 @@ string feature_description_at(const coord_def& where, bool covering,
             env.markers.property_at(where, MAT_ANY,
                                     "door_description_veto");
 
-        set<coord_def> all_door;
+        coord_set all_door;
         find_connected_identical(where, all_door);
         const char *adj, *noun;
         get_door_description(all_door.size(), &adj, &noun);
@@ -252,10 +252,18 @@ private:
     targetter *hitfunc;         // Determine what would be hit.
     coord_def default_place;    // Start somewhere other than you.pos()?
 
+    // Find a ray to trg, remembering results for the prompt's lifetime.
+    bool find_ray_to(const coord_def& trg, ray_def& r);
+
     // Internal data.
     ray_def beam;               // The (possibly invalid) beam.
     bool show_beam;             // Does the user want the beam displayed?
     bool have_beam;             // Is the currently stored beam valid?
+    // Rays already searched for this prompt, so that moving the cursor
+    // back across a cell is a lookup rather than a fresh quadrant scan.
+    // The level can't change while the modal prompt is up; the wizard
+    // commands that can alter it flush this.
+    map<coord_def, pair<bool, ray_def> > ray_memo;
     coord_def objfind_pos, monsfind_pos; // Cycling memory
 
     bool valid_shadow_step;     // If shadow-stepping, do we currently have a
@@ -177,6 +177,15 @@ int dlua_chunk::load(CLua &interp)
     return err;
 }
 
+// Compiles the chunk to bytecode (if it still holds only source)
+// without leaving the compiled function on the Lua stack. Used to
+// populate the compiled form before the chunk is written to a cache.
+int dlua_chunk::precompile(CLua &interp)
+{
+    lua_stack_cleaner clean(interp);
+    return load(interp);
+}
+
 int dlua_chunk::run(CLua &interp)
 {
     int err = load(interp);
@@ -26,6 +26,7 @@
 #include "butcher.h"
 #include "chardump.h"
 #include "cloud.h"
+#include "coord-set.h"
 #include "coordit.h"
 #include "directn.h"
 #include "dbg-maps.h"
@@ -871,67 +872,145 @@ static bool _is_exit_stair(const coord_def &c)
 //
 // If fill is non-zero, it fills any disconnected regions with fill.
 //
+// Zones are labelled with a single union-find sweep over the grid
+// instead of one breadth-first flood per zone; connectivity gets
+// queried several times while building a level and the floods (and
+// their per-square list allocations) dominated builder time. Squares
+// are indexed as x * GYM + y.
+static int _zone_uf_parent[GXM * GYM];
+static int _zone_uf_zone[GXM * GYM];      // root square -> 1-based zone
+static bool _zone_uf_passable[GXM][GYM];
+
+static int _zone_uf_find(int i)
+{
+    while (_zone_uf_parent[i] != i)
+        i = _zone_uf_parent[i] = _zone_uf_parent[_zone_uf_parent[i]];
+    return i;
+}
+
+static void _zone_uf_union(int a, int b)
+{
+    a = _zone_uf_find(a);
+    b = _zone_uf_find(b);
+    if (a != b)
+        _zone_uf_parent[b] = a;
+}
+
 static int _process_disconnected_zones(int x1, int y1, int x2, int y2,
                                        bool choose_stairless,
                                        dungeon_feature_type fill)
 {
     memset(travel_point_distance, 0, sizeof(travel_distance_grid_t));
+    memset(_zone_uf_zone, 0, sizeof(_zone_uf_zone));
+
+    bool (*iswanted)(const coord_def &) = nullptr;
+    if (choose_stairless)
+    {
+        iswanted = at_branch_bottom() ? _is_upwards_exit_stair
+                                      : _is_exit_stair;
+    }
+
+    // Union every passable square with its already-visited passable
+    // neighbours: the square to the west and the three in the previous
+    // row.
+    static const coord_def behind[] =
+    {
+        coord_def(-1, 0), coord_def(-1, -1), coord_def(0, -1),
+        coord_def(1, -1)
+    };
+
+    for (int y = 0; y < GYM; ++y)
+        for (int x = 0; x < GXM; ++x)
+        {
+            const int ind = x * GYM + y;
+            _zone_uf_parent[ind] = ind;
+            _zone_uf_passable[x][y] =
+                map_bounds(x, y) && _dgn_square_is_passable(coord_def(x, y));
+
+            if (!_zone_uf_passable[x][y])
+                continue;
+
+            for (const coord_def &d : behind)
+            {
+                const int nx = x + d.x, ny = y + d.y;
+                if (nx >= 0 && nx < GXM && ny >= 0
+                    && _zone_uf_passable[nx][ny])
+                {
+                    _zone_uf_union(ind, nx * GYM + ny);
+                }
+            }
+        }
+
+    // Number the zones in the order the old per-zone floods found them:
+    // by the first square of each zone inside the requested area.
     int nzones = 0;
-    int ngood = 0;
     for (int y = y1; y <= y2 ; ++y)
-    {
         for (int x = x1; x <= x2; ++x)
         {
-            if (!map_bounds(x, y)
-                || travel_point_distance[x][y]
-                || !_dgn_square_is_passable(coord_def(x, y)))
+            if (x < 0 || x >= GXM || y < 0 || y >= GYM
+                || !_zone_uf_passable[x][y])
             {
                 continue;
             }
 
-            const bool found_exit_stair =
-                _dgn_fill_zone(coord_def(x, y), ++nzones,
-                               _dgn_point_record_stub,
-                               _dgn_square_is_passable,
-                               choose_stairless ? (at_branch_bottom() ?
-                                                   _is_upwards_exit_stair :
-                                                   _is_exit_stair) : nullptr);
-
-            // If we want only stairless zones, screen out zones that did
-            // have stairs.
-            if (choose_stairless && found_exit_stair)
-                ++ngood;
-            else if (fill)
+            int &zone = _zone_uf_zone[_zone_uf_find(x * GYM + y)];
+            if (!zone)
+                zone = ++nzones;
+        }
+
+    // Numbered zones may extend outside the requested area; label every
+    // square of each such zone, and note which zones have exit stairs.
+    vector<bool> zone_has_stair(nzones + 1, false);
+    for (int y = 0; y < GYM; ++y)
+        for (int x = 0; x < GXM; ++x)
+        {
+            if (!_zone_uf_passable[x][y])
+                continue;
+
+            const int zone = _zone_uf_zone[_zone_uf_find(x * GYM + y)];
+            if (!zone)
+                continue;
+
+            travel_point_distance[x][y] = zone;
+            if (iswanted && iswanted(coord_def(x, y)))
+                zone_has_stair[zone] = true;
+        }
+
+    int ngood = 0;
+    for (int zone = 1; zone <= nzones; ++zone)
+        if (zone_has_stair[zone])
+            ++ngood;
+
+    if (fill)
+    {
+        // Don't fill in areas connected to vaults.
+        // We want vaults to be accessible; if the area is disconneted
+        // from the rest of the level, this will cause the level to be
+        // vetoed later on.
+        vector<bool> veto(nzones + 1, false);
+        vector<vector<coord_def>> coords(nzones + 1);
+        for (int y = y1; y <= y2 ; ++y)
+            for (int x = x1; x <= x2; ++x)
             {
-                // Don't fill in areas connected to vaults.
-                // We want vaults to be accessible; if the area is disconneted
-                // from the rest of the level, this will cause the level to be
-                // vetoed later on.
-                bool veto = false;
-                vector<coord_def> coords;
-                for (int fy = y1; fy <= y2 ; ++fy)
-                {
-                    for (int fx = x1; fx <= x2; ++fx)
-                    {
-                        if (travel_point_distance[fx][fy] == nzones)
-                        {
-                            if (map_masked(coord_def(fx, fy), MMT_VAULT))
-                            {
-                                veto = true;
-                                break;
-                            }
-                            else
-                                coords.emplace_back(fx, fy);
-                        }
-                    }
-                    if (veto)
-                        break;
-                }
-                if (!veto)
-                {
-                    for (auto c : coords)
-                        _set_grd(c, fill);
-                }
+                if (!map_bounds(x, y))
+                    continue;
+
+                const int zone = travel_point_distance[x][y];
+                if (!zone || zone_has_stair[zone])
+                    continue;
+
+                if (map_masked(coord_def(x, y), MMT_VAULT))
+                    veto[zone] = true;
+                else
+                    coords[zone].emplace_back(x, y);
+            }
+
+        for (int zone = 1; zone <= nzones; ++zone)
+        {
+            if (!veto[zone])
+            {
+                for (auto c : coords[zone])
+                    _set_grd(c, fill);
             }
         }
     }
@@ -2365,6 +2444,23 @@ static void _build_dungeon_level(dungeon_feature_type dest_stairs_type)
 
     _check_doors();
 
+    // Cheap sanity check on the fresh layout: if it already has an
+    // isolated stairless zone, the connectivity check at the end of the
+    // build will almost certainly veto the level, so bail now, before
+    // paying for the vault, unique, trap, monster and item phases.
+    // Vault placement and exit digging can occasionally reconnect such
+    // a zone, so this is a prediction rather than a proof; the cost of
+    // a rare premature veto is one extra builder retry. Shoals is
+    // exempt because its stairs have yet to be placed at this point.
+    if (crawl_state.game_standard_levelgen()
+        && player_in_connected_branch()
+        && !(branches[you.where_are_you].branch_flags & BFLAG_ISLANDED)
+        && !player_in_branch(BRANCH_SHOALS)
+        && dgn_count_disconnected_zones(true) > 0)
+    {
+        throw dgn_veto_exception("Stairless zones after layout.");
+    }
+
     const unsigned nvaults = env.level_vaults.size();
 
     // Any further vaults must make sure not to disrupt level layout.
@@ -5309,9 +5405,9 @@ struct coord_comparator
     }
 };
 
-typedef set<coord_def, coord_comparator> coord_set;
+typedef set<coord_def, coord_comparator> ordered_coord_set;
 
-static void _jtd_init_surrounds(coord_set &coords, uint32_t mapmask,
+static void _jtd_init_surrounds(ordered_coord_set &coords, uint32_t mapmask,
                                 const coord_def &c)
 {
     vector<coord_def> cur;
@@ -5340,7 +5436,7 @@ vector<coord_def> dgn_join_the_dots_pathfind(const coord_def &from,
 {
     memset(travel_point_distance, 0, sizeof(travel_distance_grid_t));
     const coord_comparator comp(to);
-    coord_set coords(comp);
+    ordered_coord_set coords(comp);
 
     vector<coord_def> path;
     coord_def curr = from;
@@ -5928,11 +6024,11 @@ static bool _feat_is_wall_floor_liquid(dungeon_feature_type feat)
 // This tries to be like _spotty_level, but probably isn't quite.
 // It might be better to aim for a more open connection -- currently
 // it stops pretty much as soon as connectivity is attained.
-static set<coord_def> _dgn_spotty_connect_path(const coord_def& from,
+static coord_set _dgn_spotty_connect_path(const coord_def& from,
             bool (*overwriteable)(dungeon_feature_type))
 {
-    set<coord_def> flatten;
-    set<coord_def> border;
+    coord_set flatten;
+    coord_set border;
     bool success = false;
 
     if (!overwriteable)
@@ -5983,7 +6079,7 @@ static set<coord_def> _dgn_spotty_connect_path(const coord_def& from,
 static bool _connect_spotty(const coord_def& from,
                             bool (*overwriteable)(dungeon_feature_type))
 {
-    const set<coord_def> spotty_path =
+    const coord_set spotty_path =
         _dgn_spotty_connect_path(from, overwriteable);
 
     if (!spotty_path.empty())
@@ -10,6 +10,7 @@
 
 #include <cstddef>
 #include <cwctype>
+#include <map>
 #include <string>
 
 #include "stringutil.h"
@@ -25,35 +26,11 @@ bool is_vowel(const ucs_t chr)
     return low == 'a' || low == 'e' || low == 'i' || low == 'o' || low == 'u';
 }
 
-// Pluralises a monster or item name.  This'll need to be updated for
+// The suffix rules of pluralise(), once qualifiers and parenthesised
+// suffixes have been stripped.  This'll need to be updated for
 // correctness whenever new monsters/items are added.
-string pluralise(const string &name, const char * const qualifiers[],
-                 const char *no_qualifier[])
+static string _pluralise(const string &name)
 {
-    string::size_type pos;
-
-    if (qualifiers)
-    {
-        for (int i = 0; qualifiers[i]; ++i)
-            if ((pos = name.find(qualifiers[i])) != string::npos
-                && !ends_with(name, no_qualifier))
-            {
-                return pluralise(name.substr(0, pos)) + name.substr(pos);
-            }
-    }
-
-    if (!name.empty() && name[name.length() - 1] == ')'
-        && (pos = name.rfind(" (")) != string::npos)
-    {
-        return pluralise(name.substr(0, pos)) + name.substr(pos);
-    }
-
-    if (!name.empty() && name[name.length() - 1] == ']'
-        && (pos = name.rfind(" [")) != string::npos)
-    {
-        return pluralise(name.substr(0, pos)) + name.substr(pos);
-    }
-
     if (ends_with(name, "us"))
     {
         if (ends_with(name, "lotus"))
@@ -156,6 +133,47 @@ string pluralise(const string &name, const char * const qualifiers[],
     return name + "s";
 }
 
+// Pluralises a monster or item name.
+string pluralise(const string &name, const char * const qualifiers[],
+                 const char *no_qualifier[])
+{
+    string::size_type pos;
+
+    if (qualifiers)
+    {
+        for (int i = 0; qualifiers[i]; ++i)
+            if ((pos = name.find(qualifiers[i])) != string::npos
+                && !ends_with(name, no_qualifier))
+            {
+                return pluralise(name.substr(0, pos)) + name.substr(pos);
+            }
+    }
+
+    if (!name.empty() && name[name.length() - 1] == ')'
+        && (pos = name.rfind(" (")) != string::npos)
+    {
+        return pluralise(name.substr(0, pos)) + name.substr(pos);
+    }
+
+    if (!name.empty() && name[name.length() - 1] == ']'
+        && (pos = name.rfind(" [")) != string::npos)
+    {
+        return pluralise(name.substr(0, pos)) + name.substr(pos);
+    }
+
+    // The same few hundred base names come up again and again (every
+    // render of an item stack pluralises it anew), and the suffix rules
+    // are a pure function of the name, so memoise them.
+    static map<string, string> cache;
+    if (cache.size() > 1000)
+        cache.clear();
+
+    auto it = cache.find(name);
+    if (it == cache.end())
+        it = cache.insert(make_pair(name, _pluralise(name))).first;
+    return it->second;
+}
+
 string apostrophise(const string &name)
 {
     if (name.empty())
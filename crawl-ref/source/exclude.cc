@@ -254,8 +254,6 @@ void exclude_set::add_exclude_points(travel_exclude& ex)
 
     if (!ex.uptodate)
         ex.set_los();
-    else
-        ex.los.update();
 
     for (radius_iterator ri(ex.pos, ex.radius, C_ROUND); ri; ++ri)
         if (ex.affects(*ri))
@@ -264,15 +262,30 @@ void exclude_set::add_exclude_points(travel_exclude& ex)
 
 void exclude_set::update_excluded_points(bool recompute_los)
 {
+    // Redo the LOS of only the exclusions marked stale by a change in
+    // their bounds; the rest keep their cached footprints.  Recasting
+    // every exclusion's LOS for each map change made autoexplore stall
+    // on exclusion-heavy levels.
+    bool any_stale = false;
     for (iterator it = exclude_roots.begin(); it != exclude_roots.end(); ++it)
     {
         travel_exclude &ex = it->second;
         if (!ex.uptodate)
         {
-            recompute_excluded_points(recompute_los);
-            return;
+            any_stale = true;
+            if (recompute_los)
+                ex.set_los();
         }
     }
+
+    if (!any_stale)
+        return;
+
+    // The merged point set can't distinguish which exclusion supplied
+    // a point, so rebuild it - but from the cached footprints.
+    exclude_points.clear();
+    for (iterator it = exclude_roots.begin(); it != exclude_roots.end(); ++it)
+        add_exclude_points(it->second);
 }
 
 void exclude_set::recompute_excluded_points(bool recompute_los)
@@ -412,6 +425,7 @@ static void _exclude_update()
 {
     set_level_exclusion_annotation(curr_excludes.get_exclusion_desc());
     travel_cache.update_excludes();
+    travel_distance_map_invalidate();
 }
 
 static void _exclude_update(const coord_def &p)
@@ -458,7 +472,7 @@ void clear_excludes()
 
 static void _exclude_gate(const coord_def &p, bool del = false)
 {
-    set<coord_def> all_doors;
+    coord_set all_doors;
     find_connected_identical(p, all_doors);
     for (const auto &dc : all_doors)
     {
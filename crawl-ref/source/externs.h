@@ -775,6 +775,11 @@ private:
 
 private:
     dgn_marker_map markers;
+    // One bit per cell holding at least one marker, so the positional
+    // queries travel and terrain checks make for every cell answer the
+    // common no-marker case with a bit test instead of a multimap
+    // lookup.
+    map_bitmask marked_cells;
     bool have_inactive_markers;
 };
 
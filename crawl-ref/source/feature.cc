@@ -13,106 +13,44 @@ static FixedVector<feature_def, NUM_SHOW_ITEMS> item_defs;
 static int feat_index[NUM_FEATURES];
 static feature_def invis_fd, cloud_fd;
 
-/** What symbol should be used for this feature?
+/** Bake the 'feature' option overrides and the character set into a
+ *  feature_def's resolved fields.
  *
- *  @returns The symbol from the 'feature' option if given, otherwise the
- *           character corresponding to ::dchar.
- */
-ucs_t feature_def::symbol() const
-{
-    auto over = map_find(Options.feature_symbol_overrides, feat);
-    if (over && (*over)[0])
-        return get_glyph_override((*over)[0]);
-
-    return dchar_glyph(dchar);
-}
-
-/** What symbol should be used for this feature when magic mapped?
+ *  The symbol() and colour() family of accessors read the resolved
+ *  fields, so the override maps are consulted once per feature here
+ *  rather than once per cell on every redraw.  init_show_table() runs
+ *  this over every def; like init_char_table(), it must be rerun if the
+ *  relevant options change.
  *
- *  @returns The symbol from the 'feature' option if given, otherwise the
- *           character corresponding to ::magic_dchar if set, otherwise
- *           the normal symbol.
+ *  @param[out] f The feature_def to be resolved.
  */
-ucs_t feature_def::magic_symbol() const
+static void _resolve_feature_overrides(feature_def &f)
 {
-    auto over = map_find(Options.feature_symbol_overrides, feat);
-    if (over && (*over)[1])
-        return get_glyph_override((*over)[1]);
+    auto over = map_find(Options.feature_symbol_overrides, f.feat);
 
-    if (magic_dchar != NUM_DCHAR_TYPES)
-        return dchar_glyph(magic_dchar);
+    if (over && (*over)[0])
+        f.resolved_symbol = get_glyph_override((*over)[0]);
     else
-        return symbol();
-}
-
-/** What colour should be used for this feature?
- *
- *  @returns The colour from the feature option if given, otherwise
- *           the normal colour.
- */
-colour_t feature_def::colour() const
-{
-    auto ofeat = map_find(Options.feature_colour_overrides, feat);
-    if (ofeat && ofeat->dcolour)
-        return ofeat->dcolour;
-
-    return dcolour;
-}
-
-/** What colour should be used for this feature when out of LOS?
- *
- *  @returns The map_colour from the feature option if given, otherwise
- *           the normal map_colour.
- */
-colour_t feature_def::map_colour() const
-{
-    auto ofeat = map_find(Options.feature_colour_overrides, feat);
-    if (ofeat && ofeat->map_dcolour)
-        return ofeat->map_dcolour;
-
-    return map_dcolour;
-}
-
-/** What colour should be used for this feature when we have knowledge of it?
- *
- *  @returns The seen_colour from the feature option if given, otherwise
- *           the normal seen_colour.
- */
-colour_t feature_def::seen_colour() const
-{
-    auto ofeat = map_find(Options.feature_colour_overrides, feat);
-    if (ofeat && ofeat->seen_dcolour)
-        return ofeat->seen_dcolour;
-
-    return seen_dcolour;
-}
-
-/** Emphasised colour when out of LoS?
- *
- *  @returns The seen_em_colour from the feature option if given, otherwise
- *           the normal seen_em_colour.
- */
-colour_t feature_def::seen_em_colour() const
-{
-    auto ofeat = map_find(Options.feature_colour_overrides, feat);
-    if (ofeat && ofeat->seen_em_dcolour)
-        return ofeat->seen_em_dcolour;
-
-    return seen_em_dcolour;
-}
+        f.resolved_symbol = dchar_glyph(f.dchar);
 
-/** Emphasised colour in LOS?
- *
- *  @returns The em_colour from the feature option if given, otherwise
-*            the normal em_colour.
- */
-colour_t feature_def::em_colour() const
-{
-    auto ofeat = map_find(Options.feature_colour_overrides, feat);
-    if (ofeat && ofeat->em_dcolour)
-        return ofeat->em_dcolour;
-
-    return em_dcolour;
+    if (over && (*over)[1])
+        f.resolved_magic_symbol = get_glyph_override((*over)[1]);
+    else if (f.magic_dchar != NUM_DCHAR_TYPES)
+        f.resolved_magic_symbol = dchar_glyph(f.magic_dchar);
+    else
+        f.resolved_magic_symbol = f.resolved_symbol;
+
+    const feature_def *ofeat = map_find(Options.feature_colour_overrides,
+                                        f.feat);
+
+#define COL(field) f.resolved_##field = ofeat && ofeat->field ? ofeat->field \
+                                                              : f.field;
+    COL(dcolour);
+    COL(map_dcolour);
+    COL(seen_dcolour);
+    COL(em_dcolour);
+    COL(seen_em_dcolour);
+#undef COL
 }
 
 /** Do the default colour relations on a feature_def.
@@ -131,10 +69,15 @@ static void _create_colours(feature_def &f)
         f.em_dcolour = f.dcolour;
 }
 
+unsigned feat_flags_table[NUM_FEATURES];
+
 static void _init_feature_index()
 {
     for (int i = 0; i < NUM_FEATURES; ++i)
+    {
         feat_index[i] = -1;
+        feat_flags_table[i] = FFT_NONE;
+    }
 
     for (int i = 0; i < (int) ARRAYSZ(feat_defs); ++i)
     {
@@ -142,6 +85,7 @@ static void _init_feature_index()
         ASSERT_RANGE(feat, 0, NUM_FEATURES);
         ASSERT(feat_index[feat] == -1);
         feat_index[feat] = i;
+        feat_flags_table[feat] = feat_defs[i].flags;
     }
 }
 
@@ -152,6 +96,9 @@ void init_show_table()
 {
     _init_feature_index();
 
+    for (int i = 0; i < (int) ARRAYSZ(feat_defs); ++i)
+        _resolve_feature_overrides(feat_defs[i]);
+
     for (int i = 0; i < NUM_SHOW_ITEMS; i++)
     {
         show_item_type si = static_cast<show_item_type>(i);
@@ -161,15 +108,18 @@ void init_show_table()
         item_defs[si].dchar = static_cast<dungeon_char_type>(i
             + DCHAR_ITEM_DETECTED - SHOW_ITEM_DETECTED);
         _create_colours(item_defs[si]);
+        _resolve_feature_overrides(item_defs[si]);
     }
 
     invis_fd.dchar = DCHAR_INVIS_EXPOSED;
     invis_fd.minimap = MF_MONS_HOSTILE;
     _create_colours(invis_fd);
+    _resolve_feature_overrides(invis_fd);
 
     cloud_fd.dchar = DCHAR_CLOUD;
     cloud_fd.minimap = MF_SKIP;
     _create_colours(cloud_fd);
+    _resolve_feature_overrides(cloud_fd);
 }
 
 /** Get the feature_def (not necessarily in feat_defs) for this show_type.
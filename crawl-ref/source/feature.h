@@ -29,6 +29,18 @@ struct feature_def
     unsigned             flags;
     map_feature          minimap;          // mini-map categorization
 
+    // The symbols and colours above with the 'feature' option overrides
+    // and the active character set baked in, filled by init_show_table().
+    // The accessors below read these, so the per-cell display code never
+    // has to consult the option maps itself.
+    ucs_t                resolved_symbol;
+    ucs_t                resolved_magic_symbol;
+    colour_t             resolved_dcolour;
+    colour_t             resolved_map_dcolour;
+    colour_t             resolved_seen_dcolour;
+    colour_t             resolved_em_dcolour;
+    colour_t             resolved_seen_em_dcolour;
+
     feature_def(
         dungeon_feature_type feat_ = DNGN_UNSEEN,
         const char *name_ = "", const char *vaultname_ = "",
@@ -41,17 +53,21 @@ struct feature_def
         feat{feat_}, name{name_}, vaultname{vaultname_}, dchar{dchar_},
         magic_dchar{magic_dchar_}, dcolour{dcolour_}, map_dcolour{map_dcolour_},
         seen_dcolour{seen_dcolour_}, em_dcolour{em_dcolour_},
-        seen_em_dcolour{seen_em_dcolour_}, flags{flags_}, minimap{minimap_}
+        seen_em_dcolour{seen_em_dcolour_}, flags{flags_}, minimap{minimap_},
+        resolved_symbol{0}, resolved_magic_symbol{0},
+        resolved_dcolour{dcolour_}, resolved_map_dcolour{map_dcolour_},
+        resolved_seen_dcolour{seen_dcolour_}, resolved_em_dcolour{em_dcolour_},
+        resolved_seen_em_dcolour{seen_em_dcolour_}
     {}
 
     bool is_notable() const { return flags & FFT_NOTABLE; }
-    ucs_t symbol() const;
-    ucs_t magic_symbol() const;
-    colour_t colour() const;
-    colour_t map_colour() const;
-    colour_t seen_colour() const;
-    colour_t em_colour() const;
-    colour_t seen_em_colour() const;
+    ucs_t symbol() const { return resolved_symbol; }
+    ucs_t magic_symbol() const { return resolved_magic_symbol; }
+    colour_t colour() const { return resolved_dcolour; }
+    colour_t map_colour() const { return resolved_map_dcolour; }
+    colour_t seen_colour() const { return resolved_seen_dcolour; }
+    colour_t em_colour() const { return resolved_em_dcolour; }
+    colour_t seen_em_colour() const { return resolved_seen_em_dcolour; }
 };
 
 void init_show_table();
@@ -60,6 +76,12 @@ const feature_def &get_feature_def(show_type object);
 const feature_def &get_feature_def(dungeon_feature_type feat);
 bool is_valid_feature_type(dungeon_feature_type feat);
 
+// Flat table of each feature's FFT_ flags, filled by init_show_table().
+// The hot terrain predicates (feat_is_solid() and friends) read this
+// directly: one load and a bit test per cell, without the feat_index
+// indirection of get_feature_def().
+extern unsigned feat_flags_table[NUM_FEATURES];
+
 static inline bool is_notable_terrain(dungeon_feature_type ftype)
 {
     return get_feature_def(ftype).is_notable();
@@ -33,6 +33,7 @@
 #include "cloud.h"
 #include "coordit.h"
 #include "dactions.h"
+#include "delay.h"
 #include "dgn-overview.h"
 #include "directn.h"
 #include "dungeon.h"
@@ -61,6 +62,7 @@
 #include "place.h"
 #include "prompt.h"
 #include "spl-summoning.h"
+#include "stairs.h"
 #include "state.h"
 #include "stringutil.h"
 #include "syscalls.h"
@@ -87,6 +89,12 @@
 #endif
 
 static void _save_level(const level_id& lid);
+static void _load_level(const level_id& level);
+
+// Set on a level that was built ahead of time and is still awaiting its
+// first visit, so load_level() can do the usual new-level bookkeeping
+// when the player actually arrives.
+#define PREGEN_LEVEL_KEY "level_pregenerated"
 
 static bool _ghost_version_compatible(reader &ghost_reader);
 
@@ -747,15 +755,32 @@ static void _write_ghost_version(writer &outf)
         marshallInt(outf, 0);
 }
 
+static void _write_chunk_if_changed(const string &chunkname,
+                                    const vector<unsigned char> &buf);
+
 static void _write_tagged_chunk(const string &chunkname, tag_type tag)
 {
-    writer outf(you.save, chunkname);
+    vector<unsigned char> buf;
+    writer outf(&buf);
 
     // write version
     marshallUByte(outf, TAG_MAJOR_VERSION);
     marshallUByte(outf, TAG_MINOR_VERSION);
 
     tag_write(tag, outf);
+
+    // Level chunks practically always change between writes (if only in
+    // the turn counters), so don't bother comparing those.  They're also
+    // by far the bulkiest chunks and get rewritten on every level
+    // transition, so favour compression speed over a few percent of save
+    // size for them.
+    if (tag == TAG_LEVEL)
+    {
+        writer w(you.save, chunkname, Z_BEST_SPEED);
+        w.write(&buf[0], buf.size());
+    }
+    else
+        _write_chunk_if_changed(chunkname, buf);
 }
 
 static int _get_dest_stair_type(branch_type old_branch,
@@ -1339,6 +1364,7 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
 #endif
 
     bool just_created_level = false;
+    bool pregenerated_level = false;
 
     // GENERATE new level when the file can't be opened:
     if (!you.save->has_chunk(level_name))
@@ -1353,6 +1379,16 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
         dprf("Loading old level '%s'.", level_name.c_str());
         _restore_tagged_chunk(you.save, level_name, TAG_LEVEL, "Level file is invalid.");
 
+        if (load_mode == LOAD_ENTER_LEVEL
+            && env.properties.exists(PREGEN_LEVEL_KEY))
+        {
+            // Built ahead of time; the player is only now entering it
+            // for the first time, so treat it as freshly created.
+            env.properties.erase(PREGEN_LEVEL_KEY);
+            just_created_level = true;
+            pregenerated_level = true;
+        }
+
         _redraw_all();
     }
 
@@ -1373,8 +1409,10 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
     if (make_changes && env.elapsed_time && !just_created_level)
         update_level(you.elapsed_time - env.elapsed_time);
 
-    // Apply all delayed actions, if any.
-    if (just_created_level)
+    // Apply all delayed actions, if any. A pregenerated level stamped
+    // its dactions count when it was built, so only later ones need
+    // catching up.
+    if (just_created_level && !pregenerated_level)
         env.dactions_done = you.dactions.size();
     else
         catchup_dactions();
@@ -1564,11 +1602,39 @@ static void _save_level(const level_id& lid)
 # define CHUNK(short, long) long
 #endif
 
-#define SAVEFILE(short, long, savefn)           \
-    do                                          \
-    {                                           \
-        writer w(you.save, CHUNK(short, long)); \
-        savefn(w);                              \
+// Writes the marshalled bytes to the named save chunk, unless the save
+// already holds an identical copy. Decompressing the existing chunk for
+// the comparison is considerably cheaper than compressing and
+// journalling a fresh one, and several of the chunks rewritten on every
+// checkpoint save (kills, notes, Lua state, the tiles doll) change only
+// rarely between saves.
+static void _write_chunk_if_changed(const string &chunkname,
+                                    const vector<unsigned char> &buf)
+{
+    if (you.save->has_chunk(chunkname))
+    {
+        chunk_reader in(you.save, chunkname);
+        vector<char> old;
+        in.read_all(old);
+        if (old.size() == buf.size()
+            && (buf.empty() || !memcmp(&old[0], &buf[0], buf.size())))
+        {
+            return;
+        }
+    }
+
+    writer outf(you.save, chunkname);
+    if (!buf.empty())
+        outf.write(&buf[0], buf.size());
+}
+
+#define SAVEFILE(short, long, savefn)                     \
+    do                                                    \
+    {                                                     \
+        vector<unsigned char> buf;                        \
+        writer w(&buf);                                   \
+        savefn(w);                                        \
+        _write_chunk_if_changed(CHUNK(short, long), buf); \
     } while (false)
 
 // Stack allocated string's go in separate function, so Valgrind doesn't
@@ -1706,15 +1772,34 @@ static string _make_ghost_filename()
  *
  * @return A vector containing absolute paths to 0+ bonefiles.
  */
+// Cached listing of the bones directory.  Server bones directories can
+// hold thousands of files, making the readdir() on every level load
+// measurable; the directory's mtime changes whenever a bones file is
+// added or removed (including by other crawl processes), so it serves as
+// the invalidation stamp.  A bones file landing within the same second
+// as a scan may be missed until the directory changes again, which is
+// harmless.  The cache persists across games in the same process.
+static vector<string> _bones_dir_cache;
+static string _bones_dir_cached_for;
+static time_t _bones_dir_mtime = -1;
+
 static vector<string> _list_bones()
 {
     string bonefile_dir = _get_bonefile_directory();
     string base_filename = _make_ghost_filename();
     string underscored_filename = base_filename + "_";
 
-    vector<string> filenames = get_dir_files(bonefile_dir);
+    const time_t mtime = file_modtime(bonefile_dir);
+    if (bonefile_dir != _bones_dir_cached_for || mtime == 0
+        || mtime != _bones_dir_mtime)
+    {
+        _bones_dir_cache = get_dir_files(bonefile_dir);
+        _bones_dir_cached_for = bonefile_dir;
+        _bones_dir_mtime = mtime;
+    }
+
     vector<string> bonefiles;
-    for (const auto &filename : filenames)
+    for (const auto &filename : _bones_dir_cache)
         if (starts_with(filename, underscored_filename))
             bonefiles.push_back(bonefile_dir + filename);
 
@@ -2028,6 +2113,115 @@ bool is_existing_level(const level_id &level)
     return you.save && you.save->has_chunk(level.describe());
 }
 
+// Speculatively builds and saves the given level, which must not exist
+// yet, as if the player had just taken the given stair to it. The
+// player stays where they are; the entry bookkeeping load_level() does
+// for a freshly built level is deferred until they actually arrive.
+// Returns true if the level was generated.
+static bool _pregenerate_level(const level_id &next,
+                               dungeon_feature_type stair_taken)
+{
+    const level_id original = level_id::current();
+
+    _save_level(original);
+
+    you.where_are_you    = next.branch;
+    you.depth            = next.depth;
+    you.on_current_level = false;
+
+    // load_ghost() insists on the state a real level entry would have.
+    unwind_var<dungeon_feature_type> stair(you.transit_stair, stair_taken,
+                                           DNGN_UNSEEN);
+    unwind_bool ylev(you.entering_level, true, false);
+
+    env.turns_on_level = -1;
+    tile_init_default_flavour();
+    tile_clear_flavour();
+    env.tile_names.clear();
+
+    bool dummy;
+    const dungeon_feature_type stair_type =
+        static_cast<dungeon_feature_type>(
+            _get_dest_stair_type(original.branch, stair_taken, dummy));
+
+    _clear_env_map();
+    const bool built = builder(true, stair_type);
+
+    if (built)
+    {
+        // Mirror _make_level()'s post-builder initialisation: roll for
+        // player ghosts, and don't save the excursion's stale turn
+        // counter and sanctuary state with the new level. The double
+        // ghost spookmessage is skipped; the player isn't here to read
+        // it.
+        const bool is_halloween = today_is_halloween();
+        if (!crawl_state.game_is_tutorial()
+            && !crawl_state.game_is_zotdef()
+            && !Options.seed
+            && !player_in_branch(BRANCH_ABYSS)
+            && (!player_in_branch(BRANCH_DUNGEON) || you.depth > 2)
+            && one_chance_in(is_halloween ? 2 : 3))
+        {
+            if (is_halloween && coinflip())
+                load_ghost(true);
+            load_ghost(true, !is_halloween);
+        }
+        env.turns_on_level = 0;
+        env.sanctuary_pos  = coord_def(-1, -1);
+        env.sanctuary_time = 0;
+
+        // Only dactions issued after generation need catching up when
+        // the player arrives.
+        env.dactions_done = you.dactions.size();
+        env.properties[PREGEN_LEVEL_KEY] = true;
+        _save_level(next);
+    }
+
+    _load_level(original);
+    you.on_current_level = true;
+    // Quietly reactivate markers, as a level excursion would.
+    env.markers.activate_all(false);
+
+    return built;
+}
+
+// If the player is standing on a stair to a level that hasn't been
+// generated yet, build it now, while the game is waiting for input.
+// Taking the stair then only has to load the level from the save, which
+// turns the worst interactive stall we have into a disk read.
+void pregenerate_next_level()
+{
+    // The last destination we tried to build, so a vetoed-out level
+    // isn't reattempted on every prompt.
+    static level_id attempted;
+
+    if (!you.save || !crawl_state.need_save
+        || crawl_state.game_is_arena()
+        || crawl_state.generating_level
+        || you_are_delayed()
+        || you.running)
+    {
+        return;
+    }
+
+    const dungeon_feature_type feat = orig_terrain(you.pos());
+    if (feat_stair_direction(feat) == CMD_NO_CMD || feat_is_trap(feat))
+        return;
+
+    const level_id next = stair_destination(you.pos(), false);
+    if (!next.is_valid()
+        || next == level_id::current()
+        || next == attempted
+        || !is_connected_branch(next)
+        || is_existing_level(next))
+    {
+        return;
+    }
+
+    attempted = next;
+    _pregenerate_level(next, feat);
+}
+
 void delete_level(const level_id &level)
 {
     travel_cache.erase_level_info(level);
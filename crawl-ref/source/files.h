@@ -79,6 +79,10 @@ bool restore_game(const string& filename);
 
 bool is_existing_level(const level_id &level);
 
+// Build the level behind the stairs the player is standing on, if any,
+// while the game is waiting for input.
+void pregenerate_next_level();
+
 class level_excursion
 {
 protected:
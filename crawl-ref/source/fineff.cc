@@ -8,6 +8,8 @@
 
 #include "fineff.h"
 
+#include <typeinfo>
+
 #include "act-iter.h"
 #include "bloodspatter.h"
 #include "coordit.h"
@@ -36,7 +38,10 @@
 {
     for (auto fe : env.final_effects)
     {
-        if (fe->mergeable(*eff))
+        // Effects of different types never merge; checking that here
+        // is much cheaper than the dynamic_cast every mergeable()
+        // otherwise performs against each queued effect.
+        if (typeid(*fe) == typeid(*eff) && fe->mergeable(*eff))
         {
             fe->merge(*eff);
             delete eff;
@@ -70,6 +70,15 @@ public:
         return mData[i.x][i.y];
     }
 
+    // ----- Bulk access -----
+    // The cells are stored contiguously, column by column.  Whole-grid
+    // passes that don't care about the coordinate can iterate the flat
+    // range instead of paying rectangle_iterator per cell.
+    TYPE* begin() { return mData[0].buffer(); }
+    TYPE* end() { return begin() + WIDTH * HEIGHT; }
+    const TYPE* begin() const { return mData[0].buffer(); }
+    const TYPE* end() const { return begin() + WIDTH * HEIGHT; }
+
     void init(const TYPE& def)
     {
         for (int i = 0; i < WIDTH; ++i)
@@ -1,6 +1,14 @@
 /**
  * @file
  * @brief flood_find template
+ *
+ * The fill runs on travel_pathfind's frontier: a double-buffered flat
+ * FixedVector of coordinates swapped once per BFS ring, not a linked
+ * list, so builder-time connectivity checks already expand cells from
+ * contiguous storage.  The grid accessor and bound check are template
+ * parameters and inline into path_flood(); the one indirection left is
+ * the virtual path_flood() call itself, which is the price of sharing
+ * travel_pathfind rather than keeping a second flood-fill engine.
 **/
 
 #ifndef FLOOD_FIND_H
@@ -46,7 +54,6 @@ flood_find<fgrd, bound_check>::flood_find(const fgrd &f, const bound_check &bc,
       needed_features(), needed_points(), left_vault(true), vaults(nullptr),
       fgrid(f), bcheck(bc)
 {
-    memset(needed_features, false, sizeof needed_features);
 }
 
 template <typename fgrd, typename bound_check>
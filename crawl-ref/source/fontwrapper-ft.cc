@@ -283,7 +283,8 @@ void FTFontWrapper::load_glyph(unsigned int c, ucs_t uchar)
 unsigned int FTFontWrapper::map_unicode(ucs_t uchar)
 {
     unsigned int c;  // index in m_glyphs
-    if (!m_glyphmap.count(uchar))
+    map<ucs_t, unsigned int>::iterator glyph = m_glyphmap.find(uchar);
+    if (glyph == m_glyphmap.end())
     {
         // work out which glyph we can overwrite if we've gone over MAX_GLYPHS
         if (m_glyphs_top == MAX_GLYPHS)
@@ -324,16 +325,16 @@ unsigned int FTFontWrapper::map_unicode(ucs_t uchar)
     }
     else // we found uchar in glyphmap
     {
-        c = m_glyphmap[uchar];
+        c = glyph->second;
         if (m_glyphs_mru != c)
         {
             // point the <char previous to this one> to the <char after this one> and vice-versa
             dprintf("moving %lc: %lc -> %lc; %lc <- %lc",
                     uchar,
-                    m_glyphs[m_glyphs[m_glyphmap[uchar]].prev].uchar,
-                    m_glyphs[m_glyphs[m_glyphmap[uchar]].next].uchar,
-                    m_glyphs[m_glyphs[m_glyphmap[uchar]].next].uchar,
-                    m_glyphs[m_glyphs[m_glyphmap[uchar]].prev].uchar);
+                    m_glyphs[m_glyphs[c].prev].uchar,
+                    m_glyphs[m_glyphs[c].next].uchar,
+                    m_glyphs[m_glyphs[c].next].uchar,
+                    m_glyphs[m_glyphs[c].prev].uchar);
             m_glyphs[m_glyphs[c].prev].next = m_glyphs[c].next;
             m_glyphs[m_glyphs[c].next].prev = m_glyphs[c].prev;
         }
@@ -360,7 +361,7 @@ unsigned int FTFontWrapper::map_unicode(ucs_t uchar)
             m_glyphs[m_glyphs_lru].uchar,
             m_glyphs[m_glyphs[m_glyphs_lru].next].uchar);
 
-    return m_glyphmap[uchar];
+    return c;
 }
 
 void FTFontWrapper::render_textblock(unsigned int x_pos, unsigned int y_pos,
@@ -201,7 +201,7 @@ void formatted_string::parse_string1(const string &s, formatted_string &fs,
 
         if (!currs.empty())
         {
-            fs.cprintf(currs);
+            fs.cprintf(move(currs));
             currs.clear();
         }
 
@@ -228,7 +228,7 @@ void formatted_string::parse_string1(const string &s, formatted_string &fs,
         tag += tagtext.length() + 1;
     }
     if (currs.length())
-        fs.cprintf(currs);
+        fs.cprintf(move(currs));
 }
 
 formatted_string::operator string() const
@@ -479,9 +479,33 @@ void formatted_string::cprintf(const char *s, ...)
     va_end(args);
 }
 
+// Append text into the trailing text op where possible, so that building
+// a line through many cprintf() calls grows a single buffer instead of
+// allocating an op per call. The length cap matches the one used by
+// parse_string1(): fs_op::display() feeds its text to the console
+// cprintf(), which formats into a fixed-size buffer.
+static const size_t MAX_TEXT_OP_LENGTH = 999;
+
 void formatted_string::cprintf(const string &s)
 {
-    ops.push_back(s);
+    if (!ops.empty() && ops.back().type == FSOP_TEXT
+        && ops.back().text.length() + s.length() < MAX_TEXT_OP_LENGTH)
+    {
+        ops.back().text += s;
+    }
+    else
+        ops.push_back(s);
+}
+
+void formatted_string::cprintf(string &&s)
+{
+    if (!ops.empty() && ops.back().type == FSOP_TEXT
+        && ops.back().text.length() + s.length() < MAX_TEXT_OP_LENGTH)
+    {
+        ops.back().text += s;
+    }
+    else
+        ops.push_back(move(s));
 }
 
 void formatted_string::fs_op::display() const
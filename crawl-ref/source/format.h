@@ -25,6 +25,7 @@ public:
 
     void cprintf(PRINTF(1, ));
     void cprintf(const string &s);
+    void cprintf(string &&s);
     void add_glyph(cglyph_t g);
     void textcolour(int colour);
     formatted_string chop(int length) const;
@@ -83,6 +84,11 @@ public:
         {
         }
 
+        fs_op(string &&s)
+            : type(FSOP_TEXT), x(-1), y(-1), relative(false), text(move(s))
+        {
+        }
+
         operator fs_op_type () const
         {
             return type;
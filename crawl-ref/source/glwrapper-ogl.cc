@@ -75,9 +75,7 @@ OGLStateManager::OGLStateManager()
     glClearColor(0.0, 0.0, 0.0, 1.0f);
     glDepthFunc(GL_LEQUAL);
 
-#ifdef __ANDROID__
     m_last_tex = 0;
-#endif
 }
 
 void OGLStateManager::set(const GLState& state)
@@ -243,6 +241,9 @@ void OGLStateManager::delete_textures(size_t count, unsigned int *textures)
 {
     glDeleteTextures(count, (GLuint*)textures);
     glDebug("glDeleteTextures");
+    // Deleting the bound texture unbinds it, and freed handles can be
+    // handed out again, so don't trust the cached binding any more.
+    m_last_tex = 0;
 }
 
 void OGLStateManager::generate_textures(size_t count, unsigned int *textures)
@@ -253,11 +254,14 @@ void OGLStateManager::generate_textures(size_t count, unsigned int *textures)
 
 void OGLStateManager::bind_texture(unsigned int texture)
 {
+    // Adjacent buffers mostly draw from the same texture atlas, so
+    // skip the rebind when it's already current.
+    if (texture == m_last_tex)
+        return;
+
     glBindTexture(GL_TEXTURE_2D, texture);
     glDebug("glBindTexture");
-#ifdef __ANDROID__
     m_last_tex = texture;
-#endif
 }
 
 void OGLStateManager::load_texture(unsigned char *pixels, unsigned int width,
@@ -500,35 +504,44 @@ void OGLShapeBuffer::add_rect(const GLWPrim &rect)
         m_colour_buffer[last + 3].set(rect.col_e);
     }
 
-    // build indices
-    last = m_ind_buffer.size();
+}
 
-    if (last > 3)
-    {
-        // This is not the first box so make FOUR degenerate triangles
-        m_ind_buffer.resize(last + 6);
-        unsigned short int val = m_ind_buffer[last - 1];
+// Every rectangle buffer draws the same degenerate-triangle strip
+// (0 1 2 3, then 3 4 4 5 6 7 for the second box, and so on), so they
+// all index into one shared table instead of each rebuilding its own
+// copy on every repack.  Grows on demand and is never shrunk.
+static vector<unsigned short int> _rect_ind_buffer;
 
-        // the first three degens finish the previous box and move
-        // to the first position of the new one we just added and
-        // the fourth degen creates a triangle that is a line from p1 to p3
-        m_ind_buffer[last    ] = val++;
-        m_ind_buffer[last + 1] = val;
+static void _extend_rect_ind_buffer(size_t num_rects)
+{
+    size_t rects = _rect_ind_buffer.empty()
+                   ? 0 : (_rect_ind_buffer.size() + 2) / 6;
+    if (rects >= num_rects)
+        return;
 
-        // Now add as normal
-        m_ind_buffer[last + 2] = val++;
-        m_ind_buffer[last + 3] = val++;
-        m_ind_buffer[last + 4] = val++;
-        m_ind_buffer[last + 5] = val;
+    if (rects == 0)
+    {
+        // The first box needs no degenerate triangles.
+        for (unsigned short int i = 0; i < 4; ++i)
+            _rect_ind_buffer.push_back(i);
+        rects = 1;
     }
-    else
+
+    for (; rects < num_rects; ++rects)
     {
-        // This is the first box so don't bother making any degenerate triangles
-        m_ind_buffer.resize(last + 4);
-        m_ind_buffer[0] = 0;
-        m_ind_buffer[1] = 1;
-        m_ind_buffer[2] = 2;
-        m_ind_buffer[3] = 3;
+        const unsigned short int first = rects * 4;
+
+        // The first three degens finish the previous box and move
+        // to the first position of the new one and the fourth degen
+        // creates a triangle that is a line from p1 to p3.
+        _rect_ind_buffer.push_back(first - 1);
+        _rect_ind_buffer.push_back(first);
+
+        // Now add as normal.
+        _rect_ind_buffer.push_back(first);
+        _rect_ind_buffer.push_back(first + 1);
+        _rect_ind_buffer.push_back(first + 2);
+        _rect_ind_buffer.push_back(first + 3);
     }
 }
 
@@ -587,9 +600,13 @@ void OGLShapeBuffer::draw(const GLState &state)
     switch (m_prim_type)
     {
     case GLW_RECTANGLE:
-        glDrawElements(GL_TRIANGLE_STRIP, m_ind_buffer.size(),
-                       GL_UNSIGNED_SHORT, &m_ind_buffer[0]);
+    {
+        const size_t rects = m_position_buffer.size() / 4;
+        _extend_rect_ind_buffer(rects);
+        glDrawElements(GL_TRIANGLE_STRIP, rects * 6 - 2,
+                       GL_UNSIGNED_SHORT, &_rect_ind_buffer[0]);
         break;
+    }
     case GLW_LINES:
         glDrawArrays(GL_LINES, 0, m_position_buffer.size());
         break;
@@ -603,7 +620,6 @@ void OGLShapeBuffer::draw(const GLState &state)
 void OGLShapeBuffer::clear()
 {
     m_position_buffer.clear();
-    m_ind_buffer.clear();
     m_texture_buffer.clear();
     m_colour_buffer.clear();
 }
@@ -34,9 +34,7 @@ public:
                               int xoffset=-1, int yoffset=-1);
 protected:
     GLState m_current_state;
-#ifdef __ANDROID__
-    GLint m_last_tex;
-#endif
+    unsigned int m_last_tex;
 
 private:
     void glDebug(const char* msg);
@@ -67,7 +65,6 @@ protected:
     vector<GLW_3VF> m_position_buffer;
     vector<GLW_2VF> m_texture_buffer;
     vector<VColour> m_colour_buffer;
-    vector<unsigned short int> m_ind_buffer;
 
 private:
     void glDebug(const char* msg);
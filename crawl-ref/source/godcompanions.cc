@@ -11,6 +11,7 @@
 
 #include "branch.h"
 #include "dgn-overview.h"
+#include "libutil.h"
 #include "message.h"
 #include "mon-util.h"
 #include "religion.h"
@@ -83,9 +84,10 @@ void move_companion_to(const monster* mons, const level_id lid)
     // (or we can clone things on the other end)
     if (!(mons->flags & MF_TAKING_STAIRS))
     {
-        companion_list[mons->mid].level = lid;
-        companion_list[mons->mid].mons = follower(*mons);
-        companion_list[mons->mid].timestamp = you.elapsed_time;
+        companion &comp = companion_list[mons->mid];
+        comp.level = lid;
+        comp.mons = follower(*mons);
+        comp.timestamp = you.elapsed_time;
     }
 }
 
@@ -183,11 +185,11 @@ bool recall_offlevel_ally(mid_t mid)
 
 bool companion_is_elsewhere(mid_t mid, bool must_exist)
 {
-    if (companion_list.count(mid))
+    if (const companion *comp = map_find(companion_list, mid))
     {
-        return companion_list[mid].level != level_id::current()
+        return comp->level != level_id::current()
                || (player_in_branch(BRANCH_PANDEMONIUM)
-                   && companion_list[mid].level.branch == BRANCH_PANDEMONIUM
+                   && comp->level.branch == BRANCH_PANDEMONIUM
                    && !monster_by_mid(mid));
     }
 
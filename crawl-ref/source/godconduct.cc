@@ -843,6 +843,11 @@ static bool _god_likes_killing(const monster* victim)
 static void _handle_your_gods_response(conduct_type thing_done, int level,
                                        bool known, const monster* victim)
 {
+    // The godless don't have conducts, and this runs for every qualifying
+    // event of every kill in a fight.
+    if (you_worship(GOD_NO_GOD))
+        return;
+
     // Lucy gives no piety in Abyss. :(
     // XXX: make this not a hack...? (or remove it?)
     if (you_worship(GOD_LUGONU) && player_in_branch(BRANCH_ABYSS))
@@ -172,6 +172,7 @@ void ash_check_bondage(bool msg)
         return;
 
     int cursed[NUM_ET] = {0}, slots[NUM_ET] = {0};
+    const bool missing_hand = player_mutation_level(MUT_MISSING_HAND);
 
     for (int i = EQ_WEAPON; i < NUM_EQUIP; i++)
     {
@@ -184,15 +185,14 @@ void ash_check_bondage(bool msg)
             s = ET_ARMOUR;
         // Missing hands mean fewer rings
         else if (you.species != SP_OCTOPODE && i == EQ_LEFT_RING
-                 && player_mutation_level(MUT_MISSING_HAND))
+                 && missing_hand)
         {
             continue;
         }
         // Octopodes don't count these slots:
         else if (you.species == SP_OCTOPODE
                  && ((i == EQ_LEFT_RING || i == EQ_RIGHT_RING)
-                     || (i == EQ_RING_EIGHT
-                         && player_mutation_level(MUT_MISSING_HAND))))
+                     || (i == EQ_RING_EIGHT && missing_hand)))
         {
             continue;
         }
@@ -203,8 +203,8 @@ void ash_check_bondage(bool msg)
             continue;
         }
         // The macabre finger necklace's extra slot does count if equipped.
-        else if (!player_equip_unrand(UNRAND_FINGER_AMULET)
-                 && i == EQ_RING_AMULET)
+        else if (i == EQ_RING_AMULET
+                 && !player_equip_unrand(UNRAND_FINGER_AMULET))
         {
             continue;
         }
@@ -221,8 +221,7 @@ void ash_check_bondage(bool msg)
                 if (item.cursed() && (i != EQ_WEAPON || is_weapon(item)))
                 {
                     if (s == ET_WEAPON
-                        && (_two_handed()
-                            || player_mutation_level(MUT_MISSING_HAND)))
+                        && (_two_handed() || missing_hand))
                     {
                         cursed[ET_WEAPON] = 3;
                         cursed[ET_SHIELD] = 3;
@@ -1,11 +1,12 @@
 #ifndef HASH_H
 #define HASH_H
 
+#define FNV64 1099511628211ULL
+
 static inline uint64_t hash3(uint64_t x, uint64_t y, uint64_t z)
 {
     // Some compilers choke on big unsigneds, need to give them in hex.
     uint64_t hash=0xcbf29ce484222325ULL; // 14695981039346656037
-    #define FNV64 1099511628211ULL
     hash^=x;
     hash*=FNV64;
     hash^=y;
@@ -16,6 +17,29 @@ static inline uint64_t hash3(uint64_t x, uint64_t y, uint64_t z)
     return x;
 }
 
+// Incremental counterpart to hash3(): mix in words one at a time and
+// finalise at the end, for keys built from data that isn't in one
+// contiguous buffer.
+class FNVHash
+{
+public:
+    FNVHash() : hash(0xcbf29ce484222325ULL) { }
+
+    void mix(uint64_t x)
+    {
+        hash ^= x;
+        hash *= FNV64;
+    }
+
+    uint64_t result() const
+    {
+        return hash ^ (hash >> 27) ^ (hash << 24) ^ (hash >> 48);
+    }
+
+private:
+    uint64_t hash;
+};
+
 uint32_t hash32(const void *data, int len) PURE;
 unsigned int hash_rand(int x, uint32_t seed, uint32_t id = 0);
 
@@ -93,12 +93,31 @@ static string _log_file_name()
     return Options.shared_dir + "logfile" + crawl_state.game_type_qualifier();
 }
 
+// Fish the score field out of a raw xlogfile line.  Values escape ':'
+// as '::', so a field boundary is a single colon; score values are bare
+// integers.  Returns false if the line has no recognisable score.
+static bool _raw_line_score(const string &line, int &score)
+{
+    size_t pos = line.find("score=");
+    while (pos != string::npos)
+    {
+        if ((pos == 0 || line[pos - 1] == ':'
+                         && (pos < 2 || line[pos - 2] != ':'))
+            && isadigit(line[pos + 6]))
+        {
+            score = atoi(line.c_str() + pos + 6);
+            return true;
+        }
+        pos = line.find("score=", pos + 6);
+    }
+    return false;
+}
+
 void hiscores_new_entry(const scorefile_entry &ne)
 {
     unwind_bool score_update(crawl_state.updating_scores, true);
 
     FILE *scores;
-    int i, total_entries;
     bool inserted = false;
 
     // open highscore file (reading) -- nullptr is fatal!
@@ -112,39 +131,35 @@ void hiscores_new_entry(const scorefile_entry &ne)
     // we're at the end of the file, seek back to beginning.
     fseek(scores, 0, SEEK_SET);
 
-    // read highscore file, inserting new entry at appropriate point,
-    for (i = 0; i < SCORE_FILE_ENTRIES; i++)
+    // Work on raw lines, comparing only the score field of each.
+    // Parsing a full scorefile_entry per line is much too slow to do
+    // under the exclusive lock with a server-sized scorefile; the
+    // display code parses the file on its own after the lock is gone.
+    const int new_score = ne.get_score();
+    vector<string> lines;
+    char inbuf[1300];
+    while ((int)lines.size() < SCORE_FILE_ENTRIES
+           && fgets(inbuf, sizeof inbuf, scores))
     {
-        hs_list[i].reset(new scorefile_entry);
-        if (_hs_read(scores, *hs_list[i]) == false)
-            break;
-
-        // compare points..
-        if (!inserted && ne.get_score() >= hs_list[i]->get_score())
+        int score = 0;
+        if (!inserted
+            && (!_raw_line_score(inbuf, score) || new_score >= score))
         {
-            newest_entry = i;           // for later printing
+            newest_entry = lines.size();    // for later printing
             inserted = true;
-            // copy read entry to i+1th position
-            // Fixed a nasty overflow bug here -- Sharp
-            if (i+1 < SCORE_FILE_ENTRIES)
-            {
-                hs_list[i + 1] = move(hs_list[i]);
-                hs_list[i].reset(new scorefile_entry(ne));
-                i++;
-            }
-            else
-                *hs_list[i] = ne; // copy new entry to current position
+            lines.push_back(ne.raw_string());
         }
+        // An insertion at the cap drops the old lowest entry.
+        if ((int)lines.size() < SCORE_FILE_ENTRIES)
+            lines.push_back(inbuf);
     }
 
     // special case: lowest score, with room
-    if (!inserted && i < SCORE_FILE_ENTRIES)
+    if (!inserted && (int)lines.size() < SCORE_FILE_ENTRIES)
     {
-        newest_entry = i;
+        newest_entry = lines.size();
         inserted = true;
-        // copy new entry
-        hs_list[i].reset(new scorefile_entry(ne));
-        i++;
+        lines.push_back(ne.raw_string());
     }
 
     // If we've still not inserted it, it's not a highscore.
@@ -155,8 +170,6 @@ void hiscores_new_entry(const scorefile_entry &ne)
         return;
     }
 
-    total_entries = i;
-
     // The old code closed and reopened the score file, leading to a
     // race condition where one Crawl process could overwrite the
     // other's highscore. Now we truncate and rewrite the file without
@@ -167,11 +180,8 @@ void hiscores_new_entry(const scorefile_entry &ne)
     rewind(scores);
 
     // write scorefile entries.
-    for (i = 0; i < total_entries; i++)
-    {
-        _hs_write(scores, *hs_list[i]);
-        hs_list[i].reset(nullptr);
-    }
+    for (const string &line : lines)
+        fprintf(scores, "%s", line.c_str());
 
     // close scorefile.
     _hs_close(scores, _score_file_name());
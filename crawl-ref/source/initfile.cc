@@ -23,6 +23,7 @@
 #include "chardump.h"
 #include "clua.h"
 #include "colour.h"
+#include "dbg-prof.h"
 #include "defines.h"
 #include "delay.h"
 #include "directn.h"
@@ -1356,7 +1357,7 @@ void game_options::remove_item_glyph_override(const string &text, bool prepend)
         remove_if(item_glyph_overrides.begin(),
                   item_glyph_overrides.end(),
                   [&key](const item_glyph_override_type& arg)
-                  { return key == arg.first; }),
+                  { return key == arg.first.tostring(); }),
         item_glyph_overrides.end());
 }
 
@@ -2564,28 +2565,25 @@ void game_options::read_option_line(const string &str, bool runscript)
     // Keep unlowercased field around
     const string orig_field = field;
 
-    if (key != "name" && key != "crawl_dir" && key != "macro_dir"
-        && key != "combo"
-        && key != "species" && key != "background" && key != "job"
-        && key != "race" && key != "class" && key != "ban_pickup"
-        && key != "autopickup_exceptions"
-        && key != "explore_stop_pickup_ignore"
-        && key != "stop_travel" && key != "sound"
-        && key != "force_more_message"
-        && key != "drop_filter" && key != "lua_file" && key != "terp_file"
-        && key != "note_items" && key != "autoinscribe"
-        && key != "note_monsters" && key != "note_messages"
-        && key != "display_char" && key.find("cset") != 0 // compatibility
-        && key != "dungeon" && key != "feature"
-        && key != "mon_glyph" && key != "item_glyph"
-        && key != "fire_items_start"
-        && key != "opt" && key != "option"
-        && key != "menu_colour" && key != "menu_color"
-        && key != "message_colour" && key != "message_color"
-        && key != "levels" && key != "level" && key != "entries"
-        && key != "include" && key != "bindkey"
-        && key != "spell_slot"
-        && key != "item_slot"
+    // Option keys whose field must keep its case.  This check runs for
+    // every rc line, so use a set rather than a chain of comparisons.
+    static const set<string> capital_field_keys =
+    {
+        "name", "crawl_dir", "macro_dir", "combo",
+        "species", "background", "job", "race", "class",
+        "ban_pickup", "autopickup_exceptions",
+        "explore_stop_pickup_ignore", "stop_travel", "sound",
+        "force_more_message", "drop_filter", "lua_file", "terp_file",
+        "note_items", "autoinscribe", "note_monsters", "note_messages",
+        "display_char", "dungeon", "feature", "mon_glyph", "item_glyph",
+        "fire_items_start", "opt", "option",
+        "menu_colour", "menu_color", "message_colour", "message_color",
+        "levels", "level", "entries", "include", "bindkey",
+        "spell_slot", "item_slot",
+    };
+
+    if (!capital_field_keys.count(key)
+        && key.find("cset") != 0 // compatibility
         && key.find("font") == string::npos)
     {
         lowercase(field);
@@ -4244,6 +4242,7 @@ enum commandline_option_type
     CLO_MORGUE,
     CLO_MACRO,
     CLO_MAPSTAT,
+    CLO_MAPSTAT_JOBS,
     CLO_OBJSTAT,
     CLO_ITERATIONS,
     CLO_ARENA,
@@ -4270,6 +4269,10 @@ enum commandline_option_type
     CLO_THROTTLE,
     CLO_NO_THROTTLE,
     CLO_LIST_COMBOS, // List species, jobs, and legal combos, in that order.
+    CLO_PROFILE_TURNS,
+    CLO_BENCH,
+    CLO_RECORD,
+    CLO_REPLAY,
 #ifdef USE_TILE_WEB
     CLO_WEBTILES_SOCKET,
     CLO_AWAIT_CONNECTION,
@@ -4283,11 +4286,13 @@ static const char *cmd_ops[] =
 {
     "scores", "name", "species", "background", "dir", "rc",
     "rcdir", "tscores", "vscores", "scorefile", "morgue", "macro",
-    "mapstat", "objstat", "iters", "arena", "dump-maps", "test", "script",
+    "mapstat", "mapstat-jobs", "objstat", "iters", "arena", "dump-maps",
+    "test", "script",
     "builddb", "help", "version", "seed", "save-version", "sprint",
     "extra-opt-first", "extra-opt-last", "sprint-map", "edit-save",
     "print-charset", "tutorial", "wizard", "explore", "no-save",
     "gdb", "no-gdb", "nogdb", "throttle", "no-throttle", "list-combos",
+    "profile-turns", "bench", "record", "replay",
 #ifdef USE_TILE_WEB
     "webtiles-socket", "await-connection", "print-webtiles-options",
 #endif
@@ -4717,6 +4722,7 @@ bool parse_args(int argc, char **argv, bool rc_only)
 
     SysEnv.rcdirs.clear();
     SysEnv.map_gen_iters = 0;
+    SysEnv.map_gen_jobs = 0;
 
     if (argc < 2)           // no args!
         return true;
@@ -4888,6 +4894,29 @@ bool parse_args(int argc, char **argv, bool rc_only)
 #endif
             break;
 
+        case CLO_MAPSTAT_JOBS:
+#ifdef DEBUG_STATISTICS
+            if (!next_is_param || !isadigit(*next_arg))
+            {
+                fprintf(stderr, "Integer argument required for -%s\n", arg);
+                end(1);
+            }
+            else
+            {
+                SysEnv.map_gen_jobs = atoi(next_arg);
+                if (SysEnv.map_gen_jobs < 1)
+                    SysEnv.map_gen_jobs = 1;
+                else if (SysEnv.map_gen_jobs > 64)
+                    SysEnv.map_gen_jobs = 64;
+                nextUsed = true;
+            }
+#else
+            fprintf(stderr, "mapstat and objstat are available only in "
+                    "DEBUG_STATISTICS builds.\n");
+            end(1);
+#endif
+            break;
+
         case CLO_ARENA:
             if (!rc_only)
             {
@@ -4906,6 +4935,34 @@ bool parse_args(int argc, char **argv, bool rc_only)
             crawl_state.dump_maps = true;
             break;
 
+        case CLO_PROFILE_TURNS:
+            if (!next_is_param)
+            {
+                fprintf(stderr, "File name argument required for -%s\n", arg);
+                end(1);
+            }
+            prof_start_csv(next_arg);
+            nextUsed = true;
+            break;
+
+        case CLO_BENCH:
+            crawl_state.bench = true;
+            break;
+
+        case CLO_RECORD:
+        case CLO_REPLAY:
+            if (!next_is_param)
+            {
+                fprintf(stderr, "File name argument required for -%s\n", arg);
+                end(1);
+            }
+            if (o == CLO_RECORD)
+                start_key_recording(next_arg);
+            else
+                start_key_replay(next_arg);
+            nextUsed = true;
+            break;
+
         case CLO_LIST_COMBOS:
         {
             auto join = [](const vector<string> &vs) {
@@ -5180,6 +5237,11 @@ bool parse_args(int argc, char **argv, bool rc_only)
             current++;
     }
 
+    // A key recording is only reproducible with a fixed seed; pick one
+    // if the command line didn't, whatever the argument order was.
+    if (key_recording_active() && !Options.seed)
+        Options.seed = (uint32_t)time(nullptr);
+
     return true;
 }
 
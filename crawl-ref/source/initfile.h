@@ -56,6 +56,7 @@ public:
     vector<string> cmd_args;
 
     int map_gen_iters;
+    int map_gen_jobs;              // Worker processes for mapstat.
     unique_ptr<depth_ranges> map_gen_range;
 
     vector<string> extra_opts_first;
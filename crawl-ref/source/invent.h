@@ -107,7 +107,7 @@ public:
 
     virtual int highlight_colour() const
     {
-        return menu_colour(get_text(), item_prefix(*item), tag);
+        return cached_menu_colour(get_text(), item_prefix(*item));
     }
 
     virtual void select(int qty = -1);
@@ -40,6 +40,7 @@
 #include "skills.h"
 #include "spl-book.h"
 #include "spl-summoning.h"
+#include "stash.h"
 #include "state.h"
 #include "stringutil.h"
 #include "throw.h"
@@ -2254,6 +2255,7 @@ bool set_ident_type(object_class_type basetype, int subtype,
 
     you.type_ids[basetype][subtype] = setting;
     request_autoinscribe();
+    stash_item_type_identified();
 
     // Our item knowledge changed in a way that could possibly affect shop
     // prices. ID_UNKNOWN_TYPE is wizmode only.
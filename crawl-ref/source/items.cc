@@ -416,6 +416,48 @@ void init_item(int item)
     mitm[item].clear();
 }
 
+// The lowest index at which a free mitm slot might be found; saves
+// rescanning the low end of the array for every allocation.  The hint
+// is only advisory: destroy_item() lowers it, but slots can also be
+// freed without notice (stacks shrinking to nothing, level loads), so
+// a scan from the hint that comes up empty retries from the bottom
+// before the level is declared full.
+static int _mitm_free_hint = 0;
+
+static int _find_free_mitm_slot(int reserve)
+{
+    for (int item = _mitm_free_hint; item < (MAX_ITEMS - reserve); item++)
+        if (!mitm[item].defined())
+        {
+            _mitm_free_hint = item + 1;
+            return item;
+        }
+
+    if (_mitm_free_hint == 0)
+        return NON_ITEM;
+
+    for (int item = 0; item < (MAX_ITEMS - reserve); item++)
+        if (!mitm[item].defined())
+        {
+            _mitm_free_hint = item + 1;
+            return item;
+        }
+
+    return NON_ITEM;
+}
+
+// Returns the number of mitm slots in use, for monitoring how close
+// the level is to the item cap.
+int count_mitm_items()
+{
+    int used = 0;
+    for (int item = 0; item < MAX_ITEMS; item++)
+        if (mitm[item].defined())
+            used++;
+
+    return used;
+}
+
 // Returns an unused mitm slot, or NON_ITEM if none available.
 // The reserve is the number of item slots to not check.
 // Items may be culled if a reserve <= 10 is specified.
@@ -426,13 +468,9 @@ int get_mitm_slot(int reserve)
     if (crawl_state.game_is_arena())
         reserve = 0;
 
-    int item = NON_ITEM;
-
-    for (item = 0; item < (MAX_ITEMS - reserve); item++)
-        if (!mitm[item].defined())
-            break;
+    int item = _find_free_mitm_slot(reserve);
 
-    if (item >= MAX_ITEMS - reserve)
+    if (item == NON_ITEM)
     {
         if (crawl_state.game_is_arena())
         {
@@ -612,6 +650,9 @@ void destroy_item(int dest, bool never_created)
 
     unlink_item(dest);
     destroy_item(mitm[dest], never_created);
+
+    if (dest < _mitm_free_hint)
+        _mitm_free_hint = dest;
 }
 
 static void _handle_gone_item(const item_def &item)
@@ -2038,6 +2079,34 @@ static void _gozag_move_gold_to_top(const coord_def p)
 //
 // Returns false on error or level full - cases where you
 // keep the item.
+// The stack most recently merged into. Batch drops (multidrops, ammo
+// volleys, Gozag gold trails) land run after run of similar items on
+// the same square, so trying the last target first turns a walk over
+// the whole pile into a single probe. The cache is revalidated on
+// every use, so it can go stale without going wrong.
+static coord_def _last_merge_pos(-1, -1);
+static int _last_merge_item = NON_ITEM;
+
+static int _cached_merge_target(const item_def &item, const coord_def &p)
+{
+    if (p == _last_merge_pos
+        && _last_merge_item != NON_ITEM
+        && mitm[_last_merge_item].defined()
+        && mitm[_last_merge_item].pos == p
+        && items_stack(item, mitm[_last_merge_item]))
+    {
+        return _last_merge_item;
+    }
+
+    return NON_ITEM;
+}
+
+static void _note_merge_target(const coord_def &p, int index)
+{
+    _last_merge_pos = p;
+    _last_merge_item = index;
+}
+
 bool move_item_to_grid(int *const obj, const coord_def& p, bool silent)
 {
     ASSERT_IN_BOUNDS(p);
@@ -2070,6 +2139,20 @@ bool move_item_to_grid(int *const obj, const coord_def& p, bool silent)
     int movable_ind = -1;
     if (move_below || is_stackable_item(item))
     {
+        // Try the last merge target before walking the pile. Only valid
+        // if the item isn't already linked at p (then it might be its
+        // own target) and we don't need to scan for movable_ind anyway.
+        const int cached = _cached_merge_target(item, p);
+        if (!move_below && item.pos != p && cached != NON_ITEM && cached != ob)
+        {
+            merge_item_stacks(item, mitm[cached]);
+            inc_mitm_item_quantity(cached, item.quantity);
+            destroy_item(ob);
+            ob = cached;
+            _gozag_move_gold_to_top(p);
+            return true;
+        }
+
         // Look for similar item to stack:
         for (stack_iterator si(p); si; ++si)
         {
@@ -2085,6 +2168,7 @@ bool move_item_to_grid(int *const obj, const coord_def& p, bool silent)
                 inc_mitm_item_quantity(si->index(), item.quantity);
                 destroy_item(ob);
                 ob = si->index();
+                _note_merge_target(p, ob);
                 _gozag_move_gold_to_top(p);
                 return true;
             }
@@ -2190,27 +2274,44 @@ bool copy_item_to_grid(item_def &item, const coord_def& p,
     // Loop through items at current location.
     if (is_stackable_item(item))
     {
-        for (stack_iterator si(p); si; ++si)
+        // Try the last merge target before walking the pile, making
+        // sure the item isn't being merged into itself.
+        int merge_ind = _cached_merge_target(item, p);
+        if (merge_ind != NON_ITEM && &mitm[merge_ind] == &item)
+            merge_ind = NON_ITEM;
+
+        if (merge_ind == NON_ITEM)
         {
-            if (items_stack(item, *si))
+            for (stack_iterator si(p); si; ++si)
             {
-                item_def copy = item;
-                merge_item_stacks(copy, *si, quant_drop);
-                inc_mitm_item_quantity(si->index(), quant_drop);
-
-                if (mark_dropped)
+                if (items_stack(item, *si))
                 {
-                    // If the items on the floor already have a nonzero slot,
-                    // leave it as such, otherwise set the slot.
-                    if (!si->slot)
-                        si->slot = index_to_letter(item.link);
-
-                    si->flags |= ISFLAG_DROPPED;
-                    si->flags &= ~ISFLAG_THROWN;
+                    merge_ind = si->index();
+                    break;
                 }
-                return true;
             }
         }
+
+        if (merge_ind != NON_ITEM)
+        {
+            item_def &merged(mitm[merge_ind]);
+            item_def copy = item;
+            merge_item_stacks(copy, merged, quant_drop);
+            inc_mitm_item_quantity(merge_ind, quant_drop);
+
+            if (mark_dropped)
+            {
+                // If the items on the floor already have a nonzero slot,
+                // leave it as such, otherwise set the slot.
+                if (!merged.slot)
+                    merged.slot = index_to_letter(item.link);
+
+                merged.flags |= ISFLAG_DROPPED;
+                merged.flags &= ~ISFLAG_THROWN;
+            }
+            _note_merge_target(p, merge_ind);
+            return true;
+        }
     }
 
     // Item not found in current stack, add new item to top.
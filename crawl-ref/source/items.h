@@ -64,6 +64,7 @@ void link_items();
 void fix_item_coordinates();
 
 int get_mitm_slot(int reserve = 50);
+int count_mitm_items();
 
 void unlink_item(int dest);
 void destroy_item(item_def &item, bool never_created = false);
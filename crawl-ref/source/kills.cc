@@ -113,14 +113,7 @@ int KillMaster::total_kills() const
 {
     int grandtotal = 0;
     for (int i = KC_YOU; i < KC_NCATEGORIES; ++i)
-    {
-        if (categorized_kills[i].empty())
-            continue;
-
-        vector<kill_exp> kills;
-        int count = categorized_kills[i].get_kills(kills);
-        grandtotal += count;
-    }
+        grandtotal += categorized_kills[i].total_kills();
     return grandtotal;
 }
 
@@ -323,6 +316,17 @@ void Kills::record_kill(const monster* mon)
         k = kill_def(mon);
 }
 
+// Kill count alone, without the formatted descriptions get_kills()
+// renders for each record.
+int Kills::total_kills() const
+{
+    int count = 0;
+    for (const auto &entry : kills)
+        count += entry.second.kills;
+    count += ghosts.size();
+    return count;
+}
+
 int Kills::get_kills(vector<kill_exp> &all_kills) const
 {
     int count = 0;
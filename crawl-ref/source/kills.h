@@ -141,6 +141,7 @@ public:
     void load(reader&);
 
     int get_kills(vector<kill_exp> &v) const;
+    int total_kills() const;
     int num_kills(const monster* mon) const;
     int num_kills(const monster_info& mon) const;
 private:
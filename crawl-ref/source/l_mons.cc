@@ -556,9 +556,16 @@ static int monster_get(lua_State *ls)
     if (!attr)
         return 0;
 
-    for (const MonsAccessor &ma : mons_attrs)
-        if (!strcmp(attr, ma.attribute))
-            return ma.accessor(ls, mons, attr);
+    // Every attribute access on a monster wrapper funnels through this
+    // __index call, so look the accessor up instead of strcmp()ing down
+    // the whole list each time.
+    static map<string, const MonsAccessor*> attr_map;
+    if (attr_map.empty())
+        for (const MonsAccessor &ma : mons_attrs)
+            attr_map[ma.attribute] = &ma;
+
+    if (const MonsAccessor *const *acc = map_find(attr_map, attr))
+        return (*acc)->accessor(ls, mons, attr);
 
     return 0;
 }
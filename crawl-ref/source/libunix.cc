@@ -477,13 +477,27 @@ void cprintf(const char *format, ...)
     vsnprintf(buffer, sizeof(buffer), format, argp);
     va_end(argp);
 
+    // Decode the whole string up front and hand it to curses in one
+    // call instead of cell by cell; curses does the screen diffing and
+    // coalesces the actual terminal writes on refresh().
+    wchar_t out[sizeof(buffer)];
+    int n = 0;
     ucs_t c;
     char *bp = buffer;
     while (int s = utf8towc(&c, bp))
     {
         bp += s;
-        putwch(c);
+        out[n++] = c;
     }
+    addnwstr(out, n);
+
+#ifdef USE_TILE_WEB
+    ucs_t ubuf[sizeof(buffer)];
+    for (int i = 0; i < n; i++)
+        ubuf[i] = out[i];
+    ubuf[n] = 0;
+    tiles.put_ucs_string(ubuf);
+#endif
 }
 
 void putwch(ucs_t chr)
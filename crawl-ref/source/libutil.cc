@@ -33,6 +33,7 @@
 
 #ifdef UNIX
     #include <csignal>
+    #include <unistd.h>
 #endif
 
 #ifdef DGL_ENABLE_CORE_DUMP
@@ -602,11 +603,13 @@ static void handle_hangup(int)
     // will eventually return to _input() in main.cc, which will then
     // gracefully save the game.
 
-    // SAVE CORRUPTING BUG!!!  We're in a signal handler, calling free()
-    // when closing the FILE object is likely to lead to lock-ups, and even
-    // if it were a plain kernel-side descriptor, calling functions such
-    // as select() or read() is undefined behaviour.
-    fclose(stdin);
+    // fclose() would call free() on the FILE object, and malloc-family
+    // functions are not async-signal-safe -- if the signal interrupted a
+    // malloc() we'd deadlock on the heap lock.  close() is on the
+    // async-signal-safe list and unblocks a read() on the descriptor just
+    // as well, so close the kernel-side descriptor and leave the stdio
+    // object alone (it's never touched again: we're on our way out).
+    close(STDIN_FILENO);
 }
 # endif
 
@@ -51,7 +51,10 @@
 #include "coord.h"
 #include "coordit.h"
 #include "env.h"
+#include "files.h"
 #include "losglobal.h"
+#include "syscalls.h"
+#include "tags.h"
 
 // These determine what rays are cast in the precomputation,
 // and affect start-up time significantly.
@@ -174,24 +177,21 @@ struct los_ray : public ray_def
     }
 };
 
-// Check if the passed rays have identical footprint.
-static bool _is_same_ray(los_ray ray, vector<coord_def> newray)
+// Check if the passed ray has already been created. The footprints of
+// all registered rays are kept in a set of packed signatures: raycast()
+// registers thousands of candidate rays, and scanning every existing
+// ray's footprint for each of them made this check quadratic and the
+// dominant cost of LOS table construction.
+static bool _is_duplicate_ray(set<string>& seen, const vector<coord_def>& newray)
 {
-    if (ray.length != newray.size())
-        return false;
-    for (unsigned int i = 0; i < ray.length; i++)
-        if (ray[i] != newray[i])
-            return false;
-    return true;
-}
-
-// Check if the passed ray has already been created.
-static bool _is_duplicate_ray(vector<coord_def> newray)
-{
-    for (los_ray lray : fullrays)
-        if (_is_same_ray(lray, newray))
-            return true;
-    return false;
+    string signature;
+    signature.reserve(newray.size() * 2);
+    for (coord_def c : newray)
+    {
+        signature += static_cast<char>(c.x);
+        signature += static_cast<char>(c.y);
+    }
+    return !seen.insert(signature).second;
 }
 
 // A cellray given by fullray and index of end-point.
@@ -361,12 +361,12 @@ static vector<int> _find_minimal_cellrays()
 }
 
 // Create and register the ray defined by the arguments.
-static void _register_ray(geom::ray r)
+static void _register_ray(set<string>& seen, geom::ray r)
 {
     los_ray ray = los_ray(r);
     vector<coord_def> coords = ray.footprint();
 
-    if (coords.empty() || _is_duplicate_ray(coords))
+    if (coords.empty() || _is_duplicate_ray(seen, coords))
         return;
 
     ray.start = ray_coords.size();
@@ -429,6 +429,203 @@ static void _create_blockrays()
           n_cellrays, (unsigned int)fullrays.size(), n_min_rays);
 }
 
+// The ray/blockray tables depend only on the LOS geometry constants, so
+// they can be cached across processes. This matters for webtiles setups
+// that spawn one crawl process per player: rebuilding the tables
+// dominates process startup.
+#define RAY_CACHE_VERSION 1
+
+static string _ray_cache_path()
+{
+    string dir = savedir_versioned_path("cache");
+    if (!check_mkdir("Ray cache directory", &dir, true))
+        return "";
+    return catpath(dir, "rays.bin");
+}
+
+static void _marshall_double(writer& outf, double d)
+{
+    uint64_t bits;
+    COMPILE_CHECK(sizeof(bits) == sizeof(d));
+    memcpy(&bits, &d, sizeof(bits));
+    marshallUnsigned(outf, bits);
+}
+
+static double _unmarshall_double(reader& inf)
+{
+    const uint64_t bits = unmarshallUnsigned(inf);
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+static void _marshall_los_ray(writer& outf, const los_ray& ray)
+{
+    _marshall_double(outf, ray.r.start.x);
+    _marshall_double(outf, ray.r.start.y);
+    _marshall_double(outf, ray.r.dir.x);
+    _marshall_double(outf, ray.r.dir.y);
+    marshallInt(outf, ray.start);
+    marshallInt(outf, ray.length);
+}
+
+static los_ray _unmarshall_los_ray(reader& inf)
+{
+    geom::ray r;
+    r.start.x = _unmarshall_double(inf);
+    r.start.y = _unmarshall_double(inf);
+    r.dir.x = _unmarshall_double(inf);
+    r.dir.y = _unmarshall_double(inf);
+    los_ray ray(r);
+    ray.start = unmarshallInt(inf);
+    ray.length = unmarshallInt(inf);
+    return ray;
+}
+
+static void _save_ray_cache()
+{
+    const string path = _ray_cache_path();
+    if (path.empty())
+        return;
+
+    FILE *fp = fopen_u(path.c_str(), "wb");
+    if (!fp)
+        return;
+
+    writer outf(path, fp, true);
+
+    marshallUByte(outf, TAG_MAJOR_VERSION);
+    marshallUByte(outf, TAG_MINOR_VERSION);
+    marshallUByte(outf, RAY_CACHE_VERSION);
+    marshallInt(outf, LOS_MAX_RANGE);
+    marshallInt(outf, LOS_MAX_ANGLE);
+    marshallInt(outf, LOS_INTERCEPT_MULT);
+
+    marshallInt(outf, ray_coords.size());
+    for (coord_def c : ray_coords)
+        marshallCoord(outf, c);
+
+    const int n_min_rays = cellray_ends.size();
+    marshallInt(outf, n_min_rays);
+    for (coord_def c : cellray_ends)
+        marshallCoord(outf, c);
+
+    for (quadrant_iterator qi; qi; ++qi)
+    {
+        const vector<cellray>& min = min_cellrays(*qi);
+        marshallInt(outf, min.size());
+        for (const cellray& c : min)
+        {
+            _marshall_los_ray(outf, c.ray);
+            marshallInt(outf, c.end);
+            marshallInt(outf, c.imbalance);
+            marshallBoolean(outf, c.first_diag);
+        }
+    }
+
+    for (quadrant_iterator qi; qi; ++qi)
+        for (int i = 0; i < n_min_rays; ++i)
+            marshallBoolean(outf, blockrays(*qi)->get(i));
+
+    // Sentinel guarding against truncated writes.
+    marshallInt(outf, 0xb10c4a75);
+
+    fclose(fp);
+}
+
+static bool _load_ray_cache()
+{
+    const string path = _ray_cache_path();
+    if (path.empty())
+        return false;
+
+    FILE *fp = fopen_u(path.c_str(), "rb");
+    if (!fp)
+        return false;
+
+    try
+    {
+        reader inf(fp, TAG_MINOR_VERSION);
+        // A truncated cache file should throw short_read_exception so we
+        // fall through to regenerating it, not die_noline().
+        inf.set_safe_read(true);
+
+        if (unmarshallUByte(inf) != TAG_MAJOR_VERSION
+            || unmarshallUByte(inf) != TAG_MINOR_VERSION
+            || unmarshallUByte(inf) != RAY_CACHE_VERSION
+            || unmarshallInt(inf) != LOS_MAX_RANGE
+            || unmarshallInt(inf) != LOS_MAX_ANGLE
+            || unmarshallInt(inf) != LOS_INTERCEPT_MULT)
+        {
+            fclose(fp);
+            return false;
+        }
+
+        const int n_coords = unmarshallInt(inf);
+        ray_coords.clear();
+        ray_coords.reserve(n_coords);
+        for (int i = 0; i < n_coords; ++i)
+            ray_coords.push_back(unmarshallCoord(inf));
+
+        const int n_min_rays = unmarshallInt(inf);
+        cellray_ends.clear();
+        cellray_ends.reserve(n_min_rays);
+        for (int i = 0; i < n_min_rays; ++i)
+            cellray_ends.push_back(unmarshallCoord(inf));
+
+        for (quadrant_iterator qi; qi; ++qi)
+        {
+            const int count = unmarshallInt(inf);
+            vector<cellray>& min = min_cellrays(*qi);
+            min.clear();
+            min.reserve(count);
+            for (int i = 0; i < count; ++i)
+            {
+                cellray c(_unmarshall_los_ray(inf), 0);
+                c.end = unmarshallInt(inf);
+                c.imbalance = unmarshallInt(inf);
+                c.first_diag = unmarshallBoolean(inf);
+                min.push_back(c);
+            }
+        }
+
+        for (quadrant_iterator qi; qi; ++qi)
+        {
+            blockrays(*qi) = new bit_vector(n_min_rays);
+            for (int i = 0; i < n_min_rays; ++i)
+                blockrays(*qi)->set(i, unmarshallBoolean(inf));
+        }
+
+        if (unmarshallInt(inf) != static_cast<int32_t>(0xb10c4a75))
+            throw short_read_exception();
+
+        fclose(fp);
+
+        dead_rays  = new bit_vector(n_min_rays);
+        smoke_rays = new bit_vector(n_min_rays);
+
+        return true;
+    }
+    catch (short_read_exception &E)
+    {
+        fclose(fp);
+        // Toss the partially loaded tables; raycast() rebuilds them.
+        ray_coords.clear();
+        cellray_ends.clear();
+        for (quadrant_iterator qi; qi; ++qi)
+        {
+            min_cellrays(*qi).clear();
+            delete blockrays(*qi);
+            blockrays(*qi) = nullptr;
+        }
+        delete dead_rays;
+        dead_rays = nullptr;
+        delete smoke_rays;
+        smoke_rays = nullptr;
+        return false;
+    }
+}
+
 static int _gcd(int x, int y)
 {
     int tmp;
@@ -458,10 +655,16 @@ static void raycast()
     // We have a considerable amount of overkill.
     done_raycast = true;
 
+    if (_load_ray_cache())
+        return;
+
+    // Footprint signatures of the rays registered so far.
+    set<string> seen_rays;
+
     // register perpendiculars FIRST, to make them top choice
     // when selecting beams
-    _register_ray(geom::ray(0.5, 0.5, 0.0, 1.0));
-    _register_ray(geom::ray(0.5, 0.5, 1.0, 0.0));
+    _register_ray(seen_rays, geom::ray(0.5, 0.5, 0.0, 1.0));
+    _register_ray(seen_rays, geom::ray(0.5, 0.5, 1.0, 0.0));
 
     // For a slope of M = y/x, every x we move on the X axis means
     // that we move y on the y axis. We want to look at the resolution
@@ -490,14 +693,16 @@ static void raycast()
             double xstart = ((double)intercept) / (LOS_INTERCEPT_MULT*yangle);
             double ystart = 0.5;
 
-            _register_ray(geom::ray(xstart, ystart, xangle, yangle));
+            _register_ray(seen_rays, geom::ray(xstart, ystart, xangle, yangle));
             // also draw the identical ray in octant 2
-            _register_ray(geom::ray(ystart, xstart, yangle, xangle));
+            _register_ray(seen_rays, geom::ray(ystart, xstart, yangle, xangle));
         }
     }
 
     // Now create the appropriate blockrays array
     _create_blockrays();
+
+    _save_ray_cache();
 }
 
 static int _imbalance(ray_def ray, const coord_def& target)
@@ -806,7 +1011,7 @@ static void _losight_quadrant(los_grid& sh, const los_param& dat, int sx, int sy
             break;
         case OPC_HALF:
             // Block rays which have already seen a cloud.
-            *dead_rays  |= (*smoke_rays & *blockrays(*qi));
+            dead_rays->or_and(*smoke_rays, *blockrays(*qi));
             *smoke_rays |= *blockrays(*qi);
             break;
         default:
@@ -815,12 +1020,22 @@ static void _losight_quadrant(los_grid& sh, const los_param& dat, int sx, int sy
     }
 
     // Ray calculation done. Now work out which cells in this
-    // quadrant are visible.
-    for (unsigned int rayidx = 0; rayidx < num_cellrays; ++rayidx)
+    // quadrant are visible.  Walk dead_rays a word at a time, so a
+    // fully dead word - the common case with walls nearby - costs a
+    // single compare for its LONGSIZE rays.
+    const unsigned int num_words = (num_cellrays + LONGSIZE - 1) / LONGSIZE;
+    for (unsigned int w = 0; w < num_words; ++w)
     {
-        // make the cells seen by this ray at this point visible
-        if (!dead_rays->get(rayidx))
+        const unsigned int base = w * LONGSIZE;
+        unsigned long live = ~dead_rays->get_word(w);
+        // Bits past the last cellray were never set; mask them off.
+        if (base + LONGSIZE > num_cellrays)
+            live &= (1UL << (num_cellrays - base)) - 1;
+
+        for (unsigned int rayidx = base; live; live >>= 1, ++rayidx)
         {
+            if (!(live & 1))
+                continue;
             // This ray is alive, thus the end cell is visible.
             const coord_def p = coord_def(sx * cellray_ends[rayidx].x,
                                           sy * cellray_ends[rayidx].y);
@@ -888,10 +1103,20 @@ opacity_type mons_opacity(const monster* mon, los_type how)
 /////////////////////////////////////
 // A start at tracking LOS changes.
 
+// Generation counter bumped whenever any opacity in the level changes;
+// lets LOS consumers skip recomputation on quiet turns.
+static unsigned int _opacity_gen = 1;
+
+unsigned int los_opacity_generation()
+{
+    return _opacity_gen;
+}
+
 // Something that affects LOS (with default parameters)
 // has changed somewhere.
 static void _handle_los_change()
 {
+    _opacity_gen++;
     invalidate_agrid();
 }
 
@@ -9,19 +9,20 @@
 
 
 los_def::los_def()
-    : show(0), opc(opc_default.clone()), bds(BDS_DEFAULT)
+    : show(0), opc(opc_default.clone()), bds(BDS_DEFAULT), valid_gen(0)
 {
 }
 
 los_def::los_def(const coord_def& c, const opacity_func &o,
                                      const circle_def &b)
-    : show(0), center(c), opc(o.clone()), bds(b)
+    : show(0), center(c), opc(o.clone()), bds(b), valid_gen(0)
 {
 }
 
 los_def::los_def(const los_def& los)
     : show(los.show), center(los.center),
-      opc(los.opc->clone()), bds(los.bds)
+      opc(los.opc->clone()), bds(los.bds),
+      valid_gen(los.valid_gen), valid_center(los.valid_center)
 {
 }
 
@@ -31,6 +32,8 @@ los_def& los_def::operator=(const los_def& los)
     {
         init(los.center, *los.opc, los.bds);
         show = los.show;
+        valid_gen = los.valid_gen;
+        valid_center = los.valid_center;
     }
     return *this;
 }
@@ -51,7 +54,14 @@ los_def::~los_def()
 
 void los_def::update()
 {
+    // Skip the ray trace if no opacity has changed since the last update
+    // from this center.
+    if (valid_gen == los_opacity_generation() && valid_center == center)
+        return;
+
     losight(show, center, *opc, bds);
+    valid_gen = los_opacity_generation();
+    valid_center = center;
 }
 
 void los_def::set_center(const coord_def& c)
@@ -68,11 +78,13 @@ void los_def::set_opacity(const opacity_func &o)
 {
     delete opc;
     opc = o.clone();
+    valid_gen = 0;
 }
 
 void los_def::set_bounds(const circle_def &b)
 {
     bds = b;
+    valid_gen = 0;
 }
 
 circle_def los_def::get_bounds() const
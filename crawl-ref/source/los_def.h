@@ -9,6 +9,10 @@ class los_def
     coord_def center;
     opacity_func const * opc;
     circle_def bds;
+    // Opacity generation and center this los_def was last computed for;
+    // update() is a no-op while they're current.
+    unsigned int valid_gen;
+    coord_def valid_center;
 
 public:
     los_def();
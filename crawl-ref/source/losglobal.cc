@@ -17,6 +17,23 @@ typedef halflos_t globallos_t[GXM][GYM];
 
 static globallos_t globallos;
 
+// Generation stamps: the halflos entries stored at a cell are only valid
+// while its stamp matches the current generation. This makes full-cache
+// invalidation a counter bump instead of a multi-megabyte clear, and
+// spatial invalidation a stamp write per cell instead of a memset.
+static uint32_t _los_gen[GXM][GYM];
+static uint32_t _cur_los_gen = 1;
+
+// Clear a cell's cached entries if they are from an older generation.
+static void _validate_cell(const coord_def& p)
+{
+    if (_los_gen[p.x][p.y] != _cur_los_gen)
+    {
+        memset(globallos[p.x][p.y], 0, sizeof(halflos_t));
+        _los_gen[p.x][p.y] = _cur_los_gen;
+    }
+}
+
 static losfield_t* _lookup_globallos(const coord_def& p, const coord_def& q)
 {
     COMPILE_CHECK(LOS_KNOWN * 2 <= sizeof(losfield_t) * 8);
@@ -28,9 +45,15 @@ static losfield_t* _lookup_globallos(const coord_def& p, const coord_def& q)
         return nullptr;
     // p < q iff p.x < q.x || p.x == q.x && p.y < q.y
     if (diff < coord_def(0, 0))
+    {
+        _validate_cell(q);
         return &globallos[q.x][q.y][-diff.x + o_half_x][-diff.y + o_half_y];
+    }
     else
+    {
+        _validate_cell(p);
         return &globallos[p.x][p.y][ diff.x + o_half_x][ diff.y + o_half_y];
+    }
 }
 
 static void _save_los(los_def* los, los_type l)
@@ -68,13 +91,18 @@ void invalidate_los_around(const coord_def& p)
     for (int y = y1; y <= y2; y++)
         for (int x = x1; x <= x2; x++)
             if (sqr(p.x - x) + sqr(p.y - y) <= sqr(LOS_MAX_RANGE) + 1)
-                memset(globallos[x][y], 0, sizeof(halflos_t));
+                _los_gen[x][y] = 0;
 }
 
 void invalidate_los()
 {
-    for (rectangle_iterator ri(0); ri; ++ri)
-        memset(globallos[ri->x][ri->y], 0, sizeof(halflos_t));
+    _cur_los_gen++;
+    if (_cur_los_gen == 0)
+    {
+        // Wrapped; stamps from the previous epoch could look current.
+        memset(_los_gen, 0, sizeof(_los_gen));
+        _cur_los_gen = 1;
+    }
 }
 
 static void _update_globallos_at(const coord_def& p, los_type l)
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "cio.h"
+#include "end.h"
 #include "files.h"
 #include "initfile.h"
 #include "libutil.h"
@@ -385,12 +386,38 @@ static string vtostr(const keyseq &seq)
     return s.str();
 }
 
+// Length of the longest trigger sequence over every keymap and macro.
+// The matching loops try successively shorter prefixes of the input
+// buffer, so this bounds how much of the buffer they need to look at;
+// without it a long queue of typed-ahead keys is rescanned in full on
+// every keypress.  Kept current by macro_add()/macro_del().
+static unsigned int longest_trigger = 0;
+static bool longest_trigger_valid = true;
+
+static unsigned int _longest_trigger()
+{
+    if (!longest_trigger_valid)
+    {
+        longest_trigger = 0;
+        for (int mc = 0; mc < KMC_CONTEXT_COUNT; ++mc)
+            for (const auto &mac : Keymaps[mc])
+                longest_trigger = max<unsigned int>(longest_trigger,
+                                                    mac.first.size());
+        for (const auto &mac : Macros)
+            longest_trigger = max<unsigned int>(longest_trigger,
+                                                mac.first.size());
+        longest_trigger_valid = true;
+    }
+    return longest_trigger;
+}
+
 /*
  * Add a macro (surprise, surprise).
  */
 static void macro_add(macromap &mapref, keyseq key, keyseq action)
 {
     mapref[key] = action;
+    longest_trigger = max<unsigned int>(longest_trigger, key.size());
 }
 
 /*
@@ -398,6 +425,9 @@ static void macro_add(macromap &mapref, keyseq key, keyseq action)
  */
 static bool macro_del(macromap &mapref, keyseq key)
 {
+    // The deleted trigger may have been the longest one; recompute
+    // lazily on the next lookup.
+    longest_trigger_valid = false;
     return mapref.erase(key) != 0;
 }
 
@@ -494,9 +524,13 @@ static void macro_buf_add_long(keyseq actions,
     // the sequence "abcdef" and macros "ab", "bcde" and "de"
     // "ab" and "de" are recognised as macros.
 
+    const unsigned int maxlen = _longest_trigger();
+
     while (!actions.empty())
     {
         tmp = actions;
+        if (tmp.size() > maxlen)
+            tmp.resize(maxlen);
 
         while (!tmp.empty())
         {
@@ -581,6 +615,9 @@ static void macro_buf_apply_command_macro()
         return;
 
     keyseq tmp = Buffer;
+    const unsigned int maxlen = _longest_trigger();
+    if (tmp.size() > maxlen)
+        tmp.resize(maxlen);
 
     // find the longest match from the start of the buffer and replace it
     while (!tmp.empty())
@@ -690,6 +727,47 @@ void macro_save()
     fclose(f);
 }
 
+// Record/replay of the raw key stream, for reproducible runs (say,
+// when chasing performance regressions).  Keys are logged here, before
+// keymap and macro expansion, so a replay passes through exactly the
+// processing the original session did -- assuming the same rc file.
+static FILE *_key_record_file = nullptr;
+static FILE *_key_replay_file = nullptr;
+
+void start_key_recording(const char *filename)
+{
+    _key_record_file = fopen_u(filename, "w");
+    if (!_key_record_file)
+    {
+        fprintf(stderr, "Can't write key recording to %s\n", filename);
+        end(1);
+    }
+    // The seed header is written with the first key, once the command
+    // line has been fully parsed and the seed has settled.
+}
+
+bool key_recording_active()
+{
+    return _key_record_file != nullptr;
+}
+
+void start_key_replay(const char *filename)
+{
+    _key_replay_file = fopen_u(filename, "r");
+    if (!_key_replay_file)
+    {
+        fprintf(stderr, "Can't read key recording from %s\n", filename);
+        end(1);
+    }
+
+    unsigned int seed = 0;
+    if (fscanf(_key_replay_file, "seed %x", &seed) == 1)
+        Options.seed = seed;
+
+    // Replays run at full speed; animation delays only slow them down.
+    crawl_state.disables.set(DIS_DELAY);
+}
+
 /*
  * Reads as many keypresses as are available (waiting for at least one),
  * and returns them as a single keyseq.
@@ -699,6 +777,20 @@ static keyseq _getch_mul(int (*rgetch)() = nullptr)
     keyseq keys;
     int    a;
 
+    // Serve recorded keys before touching the real input source.
+    if (_key_replay_file)
+    {
+        if (fscanf(_key_replay_file, "%d", &a) == 1)
+        {
+            keys.push_back(a);
+            return keys;
+        }
+        // Out of recorded keys: hand control back to the player.
+        fclose(_key_replay_file);
+        _key_replay_file = nullptr;
+        mprf(MSGCH_PROMPT, "(End of key recording.)");
+    }
+
     // Something's gone wrong with replaying keys if crawl needs to
     // get new keys from the user.
     if (crawl_state.is_replaying_keys())
@@ -718,6 +810,20 @@ static keyseq _getch_mul(int (*rgetch)() = nullptr)
     while (kbhit() || a == 0)
         keys.push_back(a = rgetch());
 
+    if (_key_record_file)
+    {
+        static bool header_written = false;
+        if (!header_written)
+        {
+            fprintf(_key_record_file, "seed %x\n", Options.seed);
+            header_written = true;
+        }
+        for (int key : keys)
+            fprintf(_key_record_file, "%d\n", key);
+        // One line per key; flush so a crash doesn't lose the session.
+        fflush(_key_record_file);
+    }
+
     return keys;
 }
 
@@ -39,6 +39,10 @@ private:
 int getchm(int (*rgetch)() = nullptr);       // keymaps applied (ie for prompts)
 int getchm(KeymapContext context, int (*rgetch)() = nullptr);
 
+void start_key_recording(const char *filename);
+void start_key_replay(const char *filename);
+bool key_recording_active();
+
 int get_ch();
 
 int getch_with_command_macros();  // keymaps and macros (ie for commands)
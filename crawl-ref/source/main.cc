@@ -50,6 +50,7 @@
 #include "crash.h"
 #include "dactions.h"
 #include "database.h"
+#include "dbg-prof.h"
 #include "dbg-scan.h"
 #include "dbg-util.h"
 #include "delay.h"
@@ -557,10 +558,16 @@ static void _show_commandline_options_help()
     puts("      Defaults to entire dungeon; same level syntax as -mapstat.");
     puts("  -iters <num>        For -mapstat and -objstat, set the number of "
          "iterations");
+    puts("  -mapstat-jobs <num> For -mapstat, number of worker processes to "
+         "fork");
 #endif
     puts("");
     puts("Miscellaneous options:");
     puts("  -dump-maps       write map Lua to stderr when parsing .des files");
+    puts("  -profile-turns <file>  write per-turn phase timings as CSV");
+    puts("  -bench           run data structure microbenchmarks and exit");
+    puts("  -record <file>   record the key stream (and seed) of this session");
+    puts("  -replay <file>   replay a recorded session at full speed");
 #ifndef TARGET_OS_WINDOWS
     puts("  -gdb/-no-gdb     produce gdb backtrace when a crash happens (default:on)");
 #endif
@@ -801,7 +808,7 @@ static void _do_wizard_command(int wiz_command, bool silent_fail)
 
     case 'l': wizard_set_xl(); break;
     case 'L': debug_place_map(false); break;
-    // case CONTROL('L'): break;
+    case CONTROL('L'): debug_turn_profile(); break;
 
     case 'm': wizard_create_spec_monster_name(); break;
     case 'M': wizard_create_spec_monster(); break;
@@ -1487,6 +1494,13 @@ static void _input()
                 if (!clua.callfn("ready", 0, 0) && !clua.error.empty())
                     mprf(MSGCH_ERROR, "Lua error: %s", clua.error.c_str());
             }
+
+            // We're about to block waiting for input; use the idle time
+            // to plan the next autoexplore step, if one looks likely,
+            // and to build the level behind any stairs we're standing
+            // on, so taking them doesn't stall on the builder.
+            explore_plan_precompute();
+            pregenerate_next_level();
         }
 
 #ifdef WATCHDOG
@@ -2444,6 +2458,8 @@ static void _update_golubria_traps()
 
 void world_reacts()
 {
+    prof_turn_start();
+
     // All markers should be activated at this point.
     ASSERT(!env.markers.need_activate());
 
@@ -2484,11 +2500,17 @@ void world_reacts()
     run_environment_effects();
 
     if (!crawl_state.game_is_arena())
+    {
+        prof_phase prof(PROF_PLAYER);
         player_reacts();
+    }
 
     abyss_morph();
     apply_noises();
-    handle_monsters(true);
+    {
+        prof_phase prof(PROF_MONSTERS);
+        handle_monsters(true);
+    }
 
     _check_banished();
 
@@ -2513,8 +2535,14 @@ void world_reacts()
         ouch(INSTANT_DEATH, KILLED_BY_QUITTING);
     }
 
-    handle_time();
-    manage_clouds();
+    {
+        prof_phase prof(PROF_TIME_EFFECTS);
+        handle_time();
+    }
+    {
+        prof_phase prof(PROF_CLOUDS);
+        manage_clouds();
+    }
     if (env.level_state & LSTATE_GLOW_MOLD)
         _update_mold();
     if (env.level_state & LSTATE_GOLUBRIA)
@@ -2545,7 +2573,10 @@ void world_reacts()
     if (!crawl_state.game_is_arena())
         player_reacts_to_monsters();
 
-    viewwindow();
+    {
+        prof_phase prof(PROF_VIEW);
+        viewwindow();
+    }
 
     if (you.cannot_act() && any_messages()
         && crawl_state.repeat_cmd != CMD_WIZARD)
@@ -2582,6 +2613,8 @@ void world_reacts()
             save_game(false);
         }
     }
+
+    prof_turn_end();
 }
 
 static command_type _get_next_cmd()
@@ -2665,7 +2698,7 @@ static int _check_adjacent(dungeon_feature_type feat, coord_def& delta)
 {
     int num = 0;
 
-    set<coord_def> doors;
+    coord_set doors;
     for (adjacent_iterator ai(you.pos(), true); ai; ++ai)
     {
         if (grd(*ai) == feat)
@@ -2678,7 +2711,7 @@ static int _check_adjacent(dungeon_feature_type feat, coord_def& delta)
                     continue;
 
                 // Check if it's part of a gate. If so, remember all its doors.
-                set<coord_def> all_door;
+                coord_set all_door;
                 find_connected_identical(*ai, all_door);
                 doors.insert(begin(all_door), end(all_door));
             }
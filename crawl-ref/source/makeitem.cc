@@ -18,6 +18,7 @@
 #include "itemprop.h"
 #include "items.h"
 #include "libutil.h" // map_find
+#include "random-weight.h"
 #include "spl-book.h"
 #include "state.h"
 #include "stepdown.h"
@@ -150,14 +151,23 @@ static weapon_type _determine_weapon_subtype(int item_level)
     }
     else if (x_chance_in_y(item_level, 20))
     {
-        // Pick a weapon based on rarity.
-        while (true)
+        // Pick a weapon based on rarity. The rarities are fixed data, so
+        // build the weighted table once instead of rejection sampling
+        // every call.
+        static vector<pair<weapon_type, int>> wpn_rarities;
+        if (wpn_rarities.empty())
         {
-            const int wpntype = random2(NUM_WEAPONS);
-
-            if (x_chance_in_y(weapon_rarity(wpntype), 10))
-                return static_cast<weapon_type>(wpntype);
+            for (int wpntype = 0; wpntype < NUM_WEAPONS; wpntype++)
+            {
+                if (weapon_rarity(wpntype) > 0)
+                {
+                    wpn_rarities.emplace_back(
+                        static_cast<weapon_type>(wpntype),
+                        weapon_rarity(wpntype));
+                }
+            }
         }
+        return *random_choose_weighted(wpn_rarities);
     }
     else if (x_chance_in_y(item_level, item_level+7))
     {
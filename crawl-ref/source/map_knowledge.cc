@@ -22,6 +22,7 @@ void set_terrain_mapped(const coord_def gc)
 #ifdef USE_TILE
     tiles.update_minimap(gc);
 #endif
+    view_mark_dirty(gc);
 }
 
 int count_detected_mons()
@@ -45,6 +46,7 @@ int count_detected_mons()
 
 void clear_map(bool clear_items, bool clear_mons)
 {
+    view_mark_all_dirty();
     for (rectangle_iterator ri(BOUNDARY_BORDER - 1); ri; ++ri)
     {
         const coord_def p = *ri;
@@ -299,6 +299,10 @@ struct map_cell
         return _trap;
     }
 
+    // Layout note: grid sweeps (travel, LOS, minimap redraws) mostly
+    // read just the flags and the feature, so those are packed together
+    // at the front of the cell; the bulky cloud/item/monster data is
+    // kept out of line behind pointers and only paid for where present.
 public:
     uint32_t flags;   // Flags describing the mappedness of this square.
 private:
@@ -2405,6 +2405,23 @@ string map_def::describe() const
                         epilogue.describe("epilogue").c_str());
 }
 
+// Compiles all of the map's Lua chunks to bytecode, so that writing the
+// map to the des cache stores compiled chunks and later processes can
+// skip the compile. Chunks that fail to compile are left as source; the
+// error will be reported when the chunk is actually used.
+void map_def::precompile_lua()
+{
+    if (index_only)
+        return;
+
+    prelude.precompile(dlua);
+    mapchunk.precompile(dlua);
+    main.precompile(dlua);
+    validate.precompile(dlua);
+    veto.precompile(dlua);
+    epilogue.precompile(dlua);
+}
+
 void map_def::strip()
 {
     if (index_only)
@@ -1175,6 +1175,7 @@ public:
     void reinit();
 
     void load();
+    void precompile_lua();
     void strip();
 
     int weight(const level_id &lid) const;
@@ -1019,6 +1019,7 @@ void map_markers::activate_markers_at(coord_def p)
 void map_markers::add(map_marker *marker)
 {
     markers.insert(dgn_pos_marker(marker->pos, marker));
+    marked_cells.set(marker->pos);
     have_inactive_markers = true;
 }
 
@@ -1033,6 +1034,8 @@ void map_markers::unlink_marker(const map_marker *marker)
             break;
         }
     }
+    if (markers.find(marker->pos) == markers.end())
+        marked_cells.set(marker->pos, false);
 }
 
 void map_markers::check_empty()
@@ -1051,6 +1054,9 @@ void map_markers::remove(map_marker *marker)
 void map_markers::remove_markers_at(const coord_def &c,
                                     map_marker_type type)
 {
+    if (!marked_cells(c))
+        return;
+
     auto els = markers.equal_range(c);
     for (auto i = els.first; i != els.second;)
     {
@@ -1061,11 +1067,16 @@ void map_markers::remove_markers_at(const coord_def &c,
             markers.erase(todel);
         }
     }
+    if (markers.find(c) == markers.end())
+        marked_cells.set(c, false);
     check_empty();
 }
 
 map_marker *map_markers::find(const coord_def &c, map_marker_type type)
 {
+    if (!marked_cells(c))
+        return nullptr;
+
     auto els = markers.equal_range(c);
     for (auto i = els.first; i != els.second; ++i)
         if (type == MAT_ANY || i->second->get_type() == type)
@@ -1094,6 +1105,7 @@ void map_markers::move(const coord_def &from, const coord_def &to)
         tmarkers.push_back(curr->second);
         markers.erase(curr);
     }
+    marked_cells.set(from, false);
 
     for (auto mark : tmarkers)
     {
@@ -1139,8 +1151,11 @@ vector<map_marker*> map_markers::get_all(const string &key, const string &val)
 
 vector<map_marker*> map_markers::get_markers_at(const coord_def &c)
 {
-    auto els = markers.equal_range(c);
     vector<map_marker*> rmarkers;
+    if (!marked_cells(c))
+        return rmarkers;
+
+    auto els = markers.equal_range(c);
     for (auto i = els.first; i != els.second; ++i)
         rmarkers.push_back(i->second);
     return rmarkers;
@@ -1149,6 +1164,9 @@ vector<map_marker*> map_markers::get_markers_at(const coord_def &c)
 string map_markers::property_at(const coord_def &c, map_marker_type type,
                                 const string &key)
 {
+    if (!marked_cells(c))
+        return "";
+
     auto els = markers.equal_range(c);
     for (auto i = els.first; i != els.second; ++i)
     {
@@ -1164,6 +1182,7 @@ void map_markers::clear()
     for (auto &entry : markers)
         delete entry.second;
     markers.clear();
+    marked_cells.reset();
     check_empty();
 }
 
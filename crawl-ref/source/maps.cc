@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
 #include <sys/param.h>
 #include <sys/types.h>
 #ifndef TARGET_COMPILER_VC
@@ -67,6 +68,50 @@ point_vector map_anchor_points;
 
 static map_vector vdefs;
 
+typedef vector<unsigned> vault_indices;
+
+// Tag -> indices into vdefs, so tag selections (including the frequent
+// chance_ tag lookups during vault placement) only look at maps that
+// carry the tag instead of scanning every map. Rebuilt lazily whenever
+// the vault list changes.
+static map<string, vault_indices> _vdefs_tag_index;
+// Name -> index into vdefs, for the by-name lookups done when resolving
+// subvaults and forced maps.
+static map<string, unsigned> _vdefs_name_index;
+static bool _vdefs_tag_index_dirty = true;
+
+static void _rebuild_vdefs_indices()
+{
+    _vdefs_tag_index.clear();
+    _vdefs_name_index.clear();
+    for (unsigned i = 0, size = vdefs.size(); i < size; ++i)
+    {
+        for (const string &t : vdefs[i].get_tags())
+            _vdefs_tag_index[t].push_back(i);
+        // insert() keeps the first entry for a duplicated name, matching
+        // the old linear scan.
+        _vdefs_name_index.insert(make_pair(vdefs[i].name, i));
+    }
+    _vdefs_tag_index_dirty = false;
+}
+
+static const vault_indices *_tag_index_lookup(const string &tag)
+{
+    if (_vdefs_tag_index_dirty)
+        _rebuild_vdefs_indices();
+
+    // has_tag() treats a space-separated list as a conjunction; any one
+    // component is enough to narrow the candidate set, and callers
+    // recheck the full condition.
+    string first = tag;
+    const string::size_type space = first.find(' ');
+    if (space != string::npos)
+        first = first.substr(0, space);
+
+    auto it = _vdefs_tag_index.find(first);
+    return it == _vdefs_tag_index.end() ? nullptr : &it->second;
+}
+
 // Parameter array that vault code can use.
 string_vector map_parameters;
 
@@ -96,7 +141,17 @@ map_section_type vault_main(vault_placement &place, const map_def *vault,
 {
 #ifdef DEBUG_DIAGNOSTICS
     if (crawl_state.map_stat_gen)
+    {
         mapstat_report_map_try(*vault);
+
+        // Time the resolve-and-place attempt so mapstat can rank the
+        // slowest maps.
+        const clock_t start = clock();
+        const map_section_type result =
+            _write_vault(const_cast<map_def&>(*vault), place, check_place);
+        mapstat_report_map_time(*vault, clock() - start);
+        return result;
+    }
 #endif
 
     // Return value of MAP_NONE forces dungeon.cc to regenerate the
@@ -525,6 +580,53 @@ coord_def find_portal_place(const vault_placement *place, bool check_place)
     return coord_def();
 }
 
+// Per-cell clearance prefix sums for the current minivault place
+// search. A cell is clear when nothing in _map_safe_vault_place()'s
+// per-cell checks could reject it; a candidate rectangle containing
+// only clear cells can then be accepted without re-running those checks
+// for each of the several hundred random candidates tried. Rectangles
+// that aren't fully clear may still be fine (blocked cells can fall
+// under a map's blank glyphs), so they fall back to the exact check.
+static int _clear_prefix[GXM + 1][GYM + 1];
+
+static void _compute_clear_prefix(bool water_ok)
+{
+    const bool in_slime = player_in_branch(BRANCH_SLIME);
+
+    memset(_clear_prefix, 0, sizeof(_clear_prefix));
+    for (int x = 0; x < GXM; ++x)
+        for (int y = 0; y < GYM; ++y)
+        {
+            const coord_def cp(x, y);
+            bool clear = _may_overwrite_feature(cp, water_ok)
+                         && !monster_at(cp)
+                         && igrd(cp) == NON_ITEM;
+
+            for (adjacent_iterator ai(cp); clear && ai; ++ai)
+            {
+                if (map_bounds(*ai)
+                    && (env.level_map_mask(*ai) & MMT_VAULT
+                        || in_slime && feat_is_stair(grd(*ai))))
+                {
+                    clear = false;
+                }
+            }
+
+            _clear_prefix[x + 1][y + 1] = (clear ? 0 : 1)
+                                          + _clear_prefix[x][y + 1]
+                                          + _clear_prefix[x + 1][y]
+                                          - _clear_prefix[x][y];
+        }
+}
+
+static bool _rect_fully_clear(const coord_def &c, const coord_def &size)
+{
+    const int x1 = c.x, y1 = c.y;
+    const int x2 = c.x + size.x, y2 = c.y + size.y;
+    return _clear_prefix[x2][y2] - _clear_prefix[x1][y2]
+           - _clear_prefix[x2][y1] + _clear_prefix[x1][y1] == 0;
+}
+
 static coord_def _find_minivault_place(
     const vault_placement &place,
     bool check_place)
@@ -541,13 +643,29 @@ static coord_def _find_minivault_place(
     // The spotty connector in the Shoals needs one more space to work.
     const int margin = MAPGEN_BORDER * 2 + player_in_branch(BRANCH_SHOALS);
 
+    // Fully clear rectangles can only be accepted early when the default
+    // placement check is in effect: a Lua check may be stricter, and
+    // overwrite_floor_cell vaults demand floor rather than mere clearance.
+    const bool fast_check = check_place
+                            && map_place_valid == _map_safe_vault_place
+                            && !place.size.zero()
+                            && !place.map.is_overwritable_layout()
+                            && !place.map.has_tag("overwrite_floor_cell");
+    if (fast_check)
+    {
+        _compute_clear_prefix(place.map.has_tag("water_ok")
+                              || player_in_branch(BRANCH_SWAMP));
+    }
+
     // Find a target area which can be safely overwritten.
     for (int tries = 0; tries < 600; ++tries)
     {
         coord_def v1(random_range(margin, GXM - margin - place.size.x),
                      random_range(margin, GYM - margin - place.size.y));
 
-        if (check_place && !map_place_valid(place.map, v1, place.size))
+        if (check_place
+            && !(fast_check && _rect_fully_clear(v1, place.size))
+            && !map_place_valid(place.map, v1, place.size))
         {
 #ifdef DEBUG_MINIVAULT_PLACEMENT
             mprf(MSGCH_DIAGNOSTICS,
@@ -689,11 +807,11 @@ static bool _map_matches_species(const map_def &map)
 
 const map_def *find_map_by_name(const string &name)
 {
-    for (const map_def &mapdef : vdefs)
-        if (mapdef.name == name)
-            return &mapdef;
+    if (_vdefs_tag_index_dirty)
+        _rebuild_vdefs_indices();
 
-    return nullptr;
+    auto it = _vdefs_name_index.find(name);
+    return it == _vdefs_name_index.end() ? nullptr : &vdefs[it->second];
 }
 
 // Discards Lua code loaded by all maps to reduce memory use. If any stripped
@@ -721,8 +839,13 @@ mapref_vector find_maps_for_tag(const string tag,
     mapref_vector maps;
     level_id place = level_id::current();
 
-    for (const map_def &mapdef : vdefs)
+    const vault_indices *tagged = _tag_index_lookup(tag);
+    if (!tagged)
+        return maps;
+
+    for (unsigned idx : *tagged)
     {
+        const map_def &mapdef = vdefs[idx];
         if (mapdef.has_tag(tag)
             && !mapdef.has_tag("dummy")
             && (!check_depth || !mapdef.has_depth()
@@ -755,6 +878,11 @@ public:
         return sel == TAG || place.is_valid();
     }
 
+    bool tag_selector() const
+    {
+        return sel == TAG;
+    }
+
     static map_selector by_place(const level_id &_place, bool _mini,
                                  maybe_bool _extra)
     {
@@ -931,17 +1059,28 @@ string vault_chance_tag(const map_def &map)
     return "";
 }
 
-typedef vector<unsigned> vault_indices;
-
 static vault_indices _eligible_maps_for_selector(const map_selector &sel)
 {
     vault_indices eligible;
 
     if (sel.valid())
     {
-        for (unsigned i = 0, size = vdefs.size(); i < size; ++i)
-            if (sel.accept(vdefs[i]))
-                eligible.push_back(i);
+        // Tag selections only need to look at maps carrying the tag.
+        if (sel.tag_selector())
+        {
+            if (const vault_indices *tagged = _tag_index_lookup(sel.tag))
+            {
+                for (unsigned i : *tagged)
+                    if (sel.accept(vdefs[i]))
+                        eligible.push_back(i);
+            }
+        }
+        else
+        {
+            for (unsigned i = 0, size = vdefs.size(); i < size; ++i)
+                if (sel.accept(vdefs[i]))
+                    eligible.push_back(i);
+        }
     }
 
     return eligible;
@@ -1315,6 +1454,7 @@ static bool _load_map_index(const string& cache, const string &base,
         lc_loaded_maps[vdef.name] = vdef.place_loaded_from;
         vdef.place_loaded_from.clear();
     }
+    _vdefs_tag_index_dirty = true;
     fclose(fp);
 
     return true;
@@ -1369,12 +1509,20 @@ static void _write_map_full(const string &filebase, size_t vs, size_t ve,
         end(1, true, "Unable to open %s for writing", cfile.c_str());
 
     writer outf(cfile, fp);
+    // map_def::load() seeks straight to a map's cache_offset, so string
+    // references into earlier maps' data would dangle.
+    outf.set_interning(false);
     marshallUByte(outf, TAG_MAJOR_VERSION);
     marshallUByte(outf, TAG_MINOR_VERSION);
     marshallByte(outf, WORD_LEN);
     marshallSigned(outf, mtime);
     for (size_t i = vs; i < ve; ++i)
+    {
+        // Store compiled Lua chunks so processes reading the cache don't
+        // have to recompile every map's prologue/epilogue from source.
+        vdefs[i].precompile_lua();
         vdefs[i].write_full(outf);
+    }
     fclose(fp);
 }
 
@@ -1488,6 +1636,7 @@ void reread_maps()
 
     // BOOM!
     vdefs.clear();
+    _vdefs_tag_index_dirty = true;
     map_files_read.clear();
     read_maps();
 }
@@ -1507,6 +1656,7 @@ void add_parsed_map(const map_def &md)
 
     map.fixup();
     vdefs.push_back(map);
+    _vdefs_tag_index_dirty = true;
 }
 
 void run_map_global_preludes()
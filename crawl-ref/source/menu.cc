@@ -1692,6 +1692,18 @@ int menu_colour(const string &text, const string &prefix, const string &tag)
     return -1;
 }
 
+int MenuEntry::cached_menu_colour(const string &txt, const string &prefix) const
+{
+    const string key = prefix + txt;
+    if (!mc_cache_valid || key != mc_cache_key)
+    {
+        mc_cache_colour = menu_colour(txt, prefix, tag);
+        mc_cache_key = key;
+        mc_cache_valid = true;
+    }
+    return mc_cache_colour;
+}
+
 int MenuHighlighter::entry_colour(const MenuEntry *entry) const
 {
     return entry->colour != MENU_ITEM_STOCK_COLOUR ? entry->colour
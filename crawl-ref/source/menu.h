@@ -112,7 +112,8 @@ public:
                int hotk = 0,
                bool preselect = false) :
         text(txt), quantity(qty), selected_qty(0), colour(-1),
-        hotkeys(), level(lev), preselected(preselect), data(nullptr)
+        hotkeys(), level(lev), preselected(preselect), data(nullptr),
+        mc_cache_colour(-1), mc_cache_valid(false)
     {
         colour = (lev == MEL_ITEM     ?  MENU_ITEM_STOCK_COLOUR :
                   lev == MEL_SUBTITLE ?  BLUE  :
@@ -158,7 +159,7 @@ public:
 
     virtual int highlight_colour() const
     {
-        return menu_colour(get_text(), "", tag);
+        return cached_menu_colour(get_text(), "");
     }
 
     virtual bool selected() const
@@ -188,6 +189,18 @@ public:
 
     virtual void add_tile(tile_def tile);
 #endif
+
+protected:
+    // menu_colour() matches every applicable menu_colour pattern
+    // against the entry, and redrawing a page recolours each visible
+    // line; cache the result keyed on the matched text, so selection
+    // toggles (which change the text) still recolour correctly.
+    int cached_menu_colour(const string &txt, const string &prefix) const;
+
+private:
+    mutable string mc_cache_key;
+    mutable int mc_cache_colour;
+    mutable bool mc_cache_valid;
 };
 
 class ToggleableMenuEntry : public MenuEntry
@@ -299,6 +299,7 @@ class message_window
     int next_line;
     int temp_line;     // starting point of temporary messages
     int input_line;    // last line-after-input
+    int dirty_from;    // first line show() still has to repaint
     vector<formatted_string> lines;
     prefix_type prompt; // current prefix prompt
 
@@ -317,6 +318,12 @@ class message_window
         return crawl_view.msgsz.x;
     }
 
+    void mark_dirty(int line)
+    {
+        if (line < dirty_from)
+            dirty_from = line;
+    }
+
     void out_line(const formatted_string& line, int n) const
     {
         cgotoxy(1, n + 1, GOTO_MSG);
@@ -392,6 +399,7 @@ class message_window
     void add_line(const formatted_string& line)
     {
         resize(); // TODO: get rid of this
+        mark_dirty(next_line);
         lines[next_line] = line;
         next_line++;
     }
@@ -410,13 +418,15 @@ class message_window
             lines[next_line-1].del_char();
             line += lines[next_line-1];
             lines[next_line-1] = line;
+            mark_dirty(next_line - 1);
         }
         show();
     }
 
 public:
     message_window()
-        : next_line(0), temp_line(0), input_line(0), prompt(P_NONE)
+        : next_line(0), temp_line(0), input_line(0), dirty_from(0),
+          prompt(P_NONE)
     {
         clear_lines(); // initialize this->lines
     }
@@ -424,7 +434,11 @@ public:
     void resize()
     {
         // XXX: broken (why?)
-        lines.resize(height());
+        if ((int) lines.size() != height())
+        {
+            lines.resize(height());
+            dirty_from = 0;
+        }
     }
 
     unsigned int out_width() const
@@ -441,6 +455,7 @@ public:
     {
         lines.clear();
         lines.resize(height());
+        dirty_from = 0;
     }
 
     bool first_col_more() const
@@ -479,29 +494,42 @@ public:
         next_line -= n;
         temp_line -= n;
         input_line -= n;
+        dirty_from = 0;
     }
 
     // write to screen (without refresh)
-    void show() const
+    void show()
     {
         // XXX: this should not be necessary as formatted_string should
         //      already do it
         textcolour(LIGHTGREY);
 
         // XXX: the screen may have resized since the last time we
-        //  called lines.resize().  We can't actually resize lines
-        //  here because this is a const method.  Display the last
-        //  height() lines if this has happened.
+        //  called lines.resize().  We can't resize lines from every
+        //  show() caller.  Display the last height() lines if this has
+        //  happened.
         const int diff = max(int(lines.size()) - height(), 0);
 
-        for (size_t i = diff; i < lines.size(); ++i)
+        // Repaint only lines changed since the last show(): this runs
+        // once per message, and on busy turns the unchanged top of the
+        // window would otherwise dominate the terminal traffic.
+        for (size_t i = max(diff, dirty_from); i < lines.size(); ++i)
             out_line(lines[i], i - diff);
+        dirty_from = lines.size();
         place_cursor();
 #ifdef USE_TILE
         tiles.set_need_redraw();
 #endif
     }
 
+    // Repaint the whole window regardless of dirty state, for when the
+    // screen has been clobbered by something else.
+    void repaint()
+    {
+        dirty_from = 0;
+        show();
+    }
+
     // temporary: to be overwritten with next item, e.g. new turn
     //            leading dash or prompt without response
     void add_item(string text, prefix_type first_col = P_NONE,
@@ -534,6 +562,7 @@ public:
         temp_line = max(temp_line, 0);
         for (int i = temp_line; i < next_line; ++i)
             lines[i].clear();
+        mark_dirty(temp_line);
         next_line = temp_line;
     }
 
@@ -608,7 +637,7 @@ message_window msgwin;
 
 void display_message_window()
 {
-    msgwin.show();
+    msgwin.repaint();
 }
 
 void clear_message_window()
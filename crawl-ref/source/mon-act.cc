@@ -132,6 +132,11 @@ static inline bool _mons_natural_regen_roll(monster* mons)
 // Do natural regeneration for monster.
 static void _monster_regenerate(monster* mons)
 {
+    // Most monsters are unhurt on most turns; heal() would ignore them
+    // anyway, so skip the habitat checks and the regen roll.
+    if (mons->hit_points == mons->max_hit_points)
+        return;
+
     if (crawl_state.disables[DIS_MON_REGEN])
         return;
 
@@ -2952,15 +2957,45 @@ static void _update_monster_attitude(monster *mon)
 // This is the routine that controls monster AI.
 //
 //---------------------------------------------------------------
+// Phase one of monster turn handling: precompute the perception data
+// that the acting monsters are about to query, before any of them has
+// mutated the world. This only warms the global LOS cache, so it is
+// read-only with respect to game state; it batches the LOS traces that
+// would otherwise be interleaved with monster moves, and gives a clean
+// seam where the whole pass could later be handed to worker threads.
+static void _precompute_monster_perception(const vector<monster *> &actors)
+{
+    for (monster *mon : actors)
+    {
+        if (mon->asleep() || mon->is_stationary() && mon->foe == MHITNOT)
+            continue;
+
+        cell_see_cell(mon->pos(), you.pos(), LOS_DEFAULT);
+        if (mon->foe != MHITYOU && mon->foe != MHITNOT
+            && !invalid_monster_index(mon->foe))
+        {
+            const monster *foe = &menv[mon->foe];
+            if (foe->alive())
+                cell_see_cell(mon->pos(), foe->pos(), LOS_DEFAULT);
+        }
+    }
+}
+
 void handle_monsters(bool with_noise)
 {
+    vector<monster *> actors;
     for (monster_iterator mi; mi; ++mi)
     {
         _pre_monster_move(*mi);
         if (!invalid_monster(*mi) && mi->alive() && mi->has_action_energy())
+        {
             monster_queue.emplace(*mi, mi->speed_increment);
+            actors.push_back(*mi);
+        }
     }
 
+    _precompute_monster_perception(actors);
+
     int tries = 0; // infinite loop protection, shouldn't be ever needed
     while (!monster_queue.empty())
     {
@@ -3322,7 +3357,7 @@ static void _mons_open_door(monster* mons, const coord_def &pos)
 
     bool was_seen   = false;
 
-    set<coord_def> all_door;
+    coord_set all_door;
     find_connected_identical(pos, all_door);
     get_door_description(all_door.size(), &adj, &noun);
 
@@ -300,6 +300,23 @@ void handle_behaviour(monster* mon)
         return;
     }
 
+    // Sleeping monsters can't plan: the full pass below boils down to
+    // "stay put, no foe" for them.  Waking isn't this function's job
+    // either -- noise reaches them through check_awaken() and the
+    // player's stealth checks run in seen_monsters_react() -- so don't
+    // re-derive all the targeting state for every sleeper on the level
+    // each turn.
+    if (mon->asleep())
+    {
+        mon->target = mon->pos();
+        if (mon->foe != MHITNOT)
+        {
+            mon->foe = MHITNOT;
+            mon->foe_memory = 0;
+        }
+        return;
+    }
+
     // Make sure monsters are not targeting the player in arena mode.
     ASSERT(!crawl_state.game_is_arena() || mon->foe != MHITYOU);
 
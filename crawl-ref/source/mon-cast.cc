@@ -78,6 +78,19 @@
 
 static bool _valid_mon_spells[NUM_SPELLS];
 
+// Static facts about each spell used by _ms_waste_of_time()'s preamble,
+// folded into one byte at startup so the per-turn eligibility scan over
+// a monster's spell list doesn't redo the school, flag and summon-cap
+// lookups for every slot.
+enum mon_spell_trait
+{
+    MST_SUMMONING    = 1 << 0,
+    MST_HARMS_AREA   = 1 << 1,
+    MST_HARMS_TARGET = 1 << 2,
+    MST_CAPPED       = 1 << 3,
+};
+static uint8_t _mon_spell_traits[NUM_SPELLS];
+
 static int  _mons_mesmerise(monster* mons, bool actual = true);
 static int  _mons_cause_fear(monster* mons, bool actual = true);
 static int  _mons_mass_confuse(monster* mons, bool actual = true);
@@ -107,10 +120,20 @@ void init_mons_spells()
         spell_type spell = (spell_type) i;
 
         _valid_mon_spells[i] = false;
+        _mon_spell_traits[i] = 0;
 
         if (!is_valid_spell(spell))
             continue;
 
+        if (spell_typematch(spell, SPTYP_SUMMONING))
+            _mon_spell_traits[i] |= MST_SUMMONING;
+        if (spell_harms_area(spell))
+            _mon_spell_traits[i] |= MST_HARMS_AREA;
+        if (spell_harms_target(spell))
+            _mon_spell_traits[i] |= MST_HARMS_TARGET;
+        if (summons_are_capped(spell))
+            _mon_spell_traits[i] |= MST_CAPPED;
+
         if (
 #if TAG_MAJOR_VERSION == 34
             spell == SPELL_MELEE ||
@@ -1992,7 +2015,7 @@ static bool _battle_cry(const monster& chief, bool check_only = false)
     return true;
 }
 
-static void _set_door(set<coord_def> door, dungeon_feature_type feat)
+static void _set_door(coord_set door, dungeon_feature_type feat)
 {
     for (const auto &dc : door)
     {
@@ -2006,7 +2029,7 @@ static bool _can_force_door_shut(const coord_def& door)
     if (grd(door) != DNGN_OPEN_DOOR)
         return false;
 
-    set<coord_def> all_door;
+    coord_set all_door;
     vector<coord_def> veto_spots;
     find_connected_identical(door, all_door);
     copy(all_door.begin(), all_door.end(), back_inserter(veto_spots));
@@ -2052,7 +2075,7 @@ static bool _should_force_door_shut(const coord_def& door)
     dungeon_feature_type old_feat = grd(door);
     int cur_tension = get_tension(GOD_NO_GOD);
 
-    set<coord_def> all_door;
+    coord_set all_door;
     vector<coord_def> veto_spots;
     find_connected_identical(door, all_door);
     copy(all_door.begin(), all_door.end(), back_inserter(veto_spots));
@@ -2135,7 +2158,7 @@ bool get_push_space(const coord_def& pos, coord_def& newpos, actor* act,
                 }
                 else // Calculate tension with monster at new location
                 {
-                    set<coord_def> all_door;
+                    coord_set all_door;
                     find_connected_identical(pos, all_door);
                     dungeon_feature_type old_feat = grd(pos);
 
@@ -2202,7 +2225,7 @@ static bool _seal_doors_and_stairs(const monster* warden,
             if (check_only)
                 return true;
 
-            set<coord_def> all_door;
+            coord_set all_door;
             vector<coord_def> veto_spots;
             find_connected_identical(*ri, all_door);
             copy(all_door.begin(), all_door.end(), back_inserter(veto_spots));
@@ -2269,7 +2292,7 @@ static bool _seal_doors_and_stairs(const monster* warden,
         // Try to seal the door
         if (grd(*ri) == DNGN_CLOSED_DOOR || grd(*ri) == DNGN_RUNED_DOOR)
         {
-            set<coord_def> all_door;
+            coord_set all_door;
             find_connected_identical(*ri, all_door);
             for (const auto &dc : all_door)
             {
@@ -3566,6 +3589,11 @@ bool handle_mon_spell(monster* mons, bolt &beem)
 
         const bolt orig_beem = beem;
 
+        // The second attempt can re-roll the spell and aim the first
+        // one just rejected; the tracer's verdict can't have changed.
+        spell_type traced_spell = SPELL_NO_SPELL;
+        coord_def traced_target;
+
         for (int attempt = 0; attempt < 2; attempt++)
         {
             beem = orig_beem;
@@ -3711,12 +3739,26 @@ bool handle_mon_spell(monster* mons, bolt &beem)
             // beam-type spells requiring tracers
             if (get_spell_flags(spell_cast) & SPFLAG_NEEDS_TRACER)
             {
-                const bool explode =
-                    spell_is_direct_explosion(spell_cast);
-                fire_tracer(mons, beem, explode);
-                // Good idea?
-                if (mons_should_fire(beem, ignore_good_idea))
-                    spellOK = true;
+                if (spell_cast == traced_spell
+                    && beem.target == traced_target)
+                {
+                    // Already traced and rejected at this aim.
+                    spellOK = false;
+                }
+                else
+                {
+                    const bool explode =
+                        spell_is_direct_explosion(spell_cast);
+                    fire_tracer(mons, beem, explode);
+                    // Good idea?
+                    if (mons_should_fire(beem, ignore_good_idea))
+                        spellOK = true;
+                    else
+                    {
+                        traced_spell  = spell_cast;
+                        traced_target = beem.target;
+                    }
+                }
             }
             else
             {
@@ -7792,21 +7834,18 @@ static bool _ms_waste_of_time(monster* mon, mon_spell_slot slot)
     spell_type monspell = slot.spell;
     actor *foe = mon->get_foe();
     const bool friendly = mon->friendly();
+    const uint8_t traits = _mon_spell_traits[monspell];
 
     // Keep friendly summoners from spamming summons constantly.
-    if (friendly
-        && !foe
-        && spell_typematch(monspell, SPTYP_SUMMONING))
-    {
+    if (friendly && !foe && traits & MST_SUMMONING)
         return true;
-    }
 
     if (!mon->wont_attack())
     {
-        if (spell_harms_area(monspell) && env.sanctuary_time > 0)
+        if (traits & MST_HARMS_AREA && env.sanctuary_time > 0)
             return true;
 
-        if (spell_harms_target(monspell) && is_sanctuary(mon->target))
+        if (traits & MST_HARMS_TARGET && is_sanctuary(mon->target))
             return true;
     }
 
@@ -7814,7 +7853,7 @@ static bool _ms_waste_of_time(monster* mon, mon_spell_slot slot)
         return true;
 
     // Don't bother casting a summon spell if we're already at its cap
-    if (summons_are_capped(monspell)
+    if (traits & MST_CAPPED
         && count_summons(mon, monspell) >= summons_limit(monspell))
     {
         return true;
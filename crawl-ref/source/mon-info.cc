@@ -20,6 +20,7 @@
 #include "env.h"
 #include "fight.h"
 #include "ghost.h"
+#include "hash.h"
 #include "itemname.h"
 #include "itemprop.h"
 #include "libutil.h"
@@ -1861,6 +1862,72 @@ void monster_info::set_colour(int col)
     _colour = col;
 }
 
+// Cache of monster_info objects for the monster pane and targeting
+// lists, keyed by mid. Building one does dozens of string constructions,
+// and most visible monsters don't change between redraws; the cached copy
+// is reused while the hash of the monster's display-relevant state stays
+// the same.
+static map<mid_t, pair<uint64_t, monster_info>> _mon_info_cache;
+
+static uint64_t _mon_info_cache_key(const monster* m)
+{
+    const int32_t props[] =
+    {
+        m->type, m->base_monster, m->hit_points, m->max_hit_points,
+        m->pos().x, m->pos().y, m->attitude, m->behaviour, m->foe,
+        static_cast<int32_t>(m->number), m->colour, m->speed,
+        static_cast<int32_t>(m->flags), static_cast<int32_t>(m->flags >> 32),
+    };
+    FNVHash h;
+    h.mix(hash32(props, sizeof(props)));
+    h.mix(m->mid);
+    h.mix(hash32(m->mname.c_str(), m->mname.length()));
+
+    for (const auto &entry : m->enchantments)
+    {
+        h.mix(entry.first);
+        h.mix(entry.second.degree);
+        h.mix(entry.second.duration);
+    }
+
+    for (int i = 0; i < NUM_MONSTER_SLOTS; i++)
+    {
+        const int idx = m->inv[i];
+        if (idx == NON_ITEM)
+            continue;
+        const item_def &item = mitm[idx];
+        const int32_t iprops[] =
+        {
+            idx, item.base_type, item.sub_type, item.plus, item.plus2,
+            static_cast<int32_t>(item.special), item.quantity,
+            static_cast<int32_t>(item.flags),
+        };
+        h.mix(i);
+        h.mix(hash32(iprops, sizeof(iprops)));
+    }
+
+    // 0 marks an empty cache entry.
+    const uint64_t key = h.result();
+    return key ? key : 1;
+}
+
+static const monster_info &_cached_monster_info(const monster* mon)
+{
+    // Not everything monster_info reads is hashed (e.g. private props),
+    // so don't let stale entries survive indefinitely.
+    if (_mon_info_cache.size() > 512)
+        _mon_info_cache.clear();
+
+    const uint64_t key = _mon_info_cache_key(mon);
+    pair<uint64_t, monster_info> &entry = _mon_info_cache[mon->mid];
+    if (entry.first != key)
+    {
+        entry.first = key;
+        entry.second = monster_info(mon);
+    }
+    return entry.second;
+}
+
 void get_monster_info(vector<monster_info>& mons)
 {
     vector<monster* > visible;
@@ -1879,7 +1946,7 @@ void get_monster_info(vector<monster_info>& mons)
             || mon->type == MONS_BALLISTOMYCETE
                 && mon->ballisto_activity > 0)
         {
-            mons.emplace_back(mon);
+            mons.push_back(_cached_monster_info(mon));
         }
     }
     sort(mons.begin(), mons.end(), monster_info::less_than_wrapper);
@@ -72,6 +72,109 @@ int mons_tracking_range(const monster* mon)
     return range;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// Shared flood fields
+//
+// Most pathfinding queries in a given turn are monsters tracking the player.
+// Rather than running a full A* search for each of them, flood a distance
+// field outward from the player once per turn and movement class, and answer
+// each monster's query by walking the downhill gradient from the monster to
+// the player. Every step of the gradient path is verified with the monster's
+// own traversability rules, so monsters no field fits (wall clingers, and
+// anything in unusual terrain) simply fall back to the per-monster A* search.
+
+static const short FLOOD_UNREACHED = SHRT_MAX;
+
+// Each class's plane uses a feature-only superset of what its monsters
+// can actually cross: a too-generous plane only proposes gradients that
+// the per-step verification rejects, costing a fallback to A*.
+enum flood_class
+{
+    FLOOD_WALK,        // ground level; can't cross water or lava
+    FLOOD_AMPHIBIOUS,  // water-capable: amphibians and pure swimmers
+    FLOOD_FLY,         // airborne and lava habitats: anything non-solid
+    NUM_FLOOD_CLASSES,
+};
+
+static FixedArray<short, GXM, GYM> _player_flood[NUM_FLOOD_CLASSES];
+static int _flood_turn[NUM_FLOOD_CLASSES] = { -1, -1, -1 };
+static coord_def _flood_pos[NUM_FLOOD_CLASSES];
+
+void mons_path_invalidate_flood()
+{
+    for (int fc = 0; fc < NUM_FLOOD_CLASSES; ++fc)
+        _flood_turn[fc] = -1;
+}
+
+static bool _flood_traversable(const coord_def &p, flood_class fc)
+{
+    const dungeon_feature_type feat = grd(p);
+    if (feat_has_solid_floor(feat) || feat_is_closed_door(feat))
+        return true;
+
+    switch (fc)
+    {
+    case FLOOD_AMPHIBIOUS:
+        return feat_is_water(feat);
+    case FLOOD_FLY:
+        return !feat_is_solid(feat);
+    default:
+        return false;
+    }
+}
+
+static flood_class _mons_flood_class(const monster* mon)
+{
+    if (mons_airborne(mons_base_type(mon), -1, false))
+        return FLOOD_FLY;
+
+    switch (mons_habitat(mon))
+    {
+    case HT_AMPHIBIOUS:
+    case HT_WATER:
+        return FLOOD_AMPHIBIOUS;
+    case HT_LAVA:
+    case HT_AMPHIBIOUS_LAVA:
+        return FLOOD_FLY;
+    default:
+        return FLOOD_WALK;
+    }
+}
+
+static void _update_player_flood(flood_class fc)
+{
+    if (_flood_turn[fc] == you.num_turns && _flood_pos[fc] == you.pos())
+        return;
+
+    _flood_turn[fc] = you.num_turns;
+    _flood_pos[fc]  = you.pos();
+
+    FixedArray<short, GXM, GYM> &flood = _player_flood[fc];
+    flood.init(FLOOD_UNREACHED);
+
+    vector<coord_def> queue;
+    flood(you.pos()) = 0;
+    queue.push_back(you.pos());
+
+    for (unsigned int i = 0; i < queue.size(); i++)
+    {
+        const coord_def c = queue[i];
+        const short next_dist = flood(c) + 1;
+        for (int dir = 0; dir < 8; dir++)
+        {
+            const coord_def n = c + Compass[dir];
+            if (!in_bounds(n) || flood(n) != FLOOD_UNREACHED)
+                continue;
+
+            if (!_flood_traversable(n, fc))
+                continue;
+
+            flood(n) = next_dist;
+            queue.push_back(n);
+        }
+    }
+}
+
 //#define DEBUG_PATHFIND
 monster_pathfind::monster_pathfind()
     : mons(nullptr), start(), target(), pos(), allow_diagonals(true),
@@ -121,9 +224,76 @@ bool monster_pathfind::init_pathfind(const monster* mon, coord_def dest,
         return true;
     }
 
+    // Try the shared flood field first; it answers the common "walk
+    // towards the player" query without a full search.
+    if (shared_flood_path())
+        return true;
+
     return start_pathfind(msg);
 }
 
+// Attempts to derive a path from the shared player distance field by
+// descending its gradient from the monster's position. Returns false
+// whenever the field doesn't apply, leaving the full A* search to decide.
+// On success the path is recorded in prev[], just as start_pathfind()
+// would have, so backtrack() and calc_waypoints() work as usual.
+bool monster_pathfind::shared_flood_path()
+{
+    if (!mons || target != you.pos() || !allow_diagonals
+        || traverse_unmapped || traverse_in_sight)
+    {
+        return false;
+    }
+
+    const flood_class fc = _mons_flood_class(mons);
+    _update_player_flood(fc);
+    const FixedArray<short, GXM, GYM> &flood = _player_flood[fc];
+
+    const short field_dist = flood(start);
+    if (field_dist == FLOOD_UNREACHED || range && field_dist > range)
+        return false;
+
+    pos = start;
+    while (pos != target)
+    {
+        const short here = flood(pos);
+        int best_dir = -1;
+        short best_dist = here;
+        // Orthogonals last, as in calc_path_to_neighbours(), so that ties
+        // prefer them and the path doesn't zigzag.
+        for (int dir = 1; dir < 8; (dir += 2) == 9 && (dir = 0))
+        {
+            const coord_def npos = pos + Compass[dir];
+            if (!in_bounds(npos))
+                continue;
+
+            const short ndist = flood(npos);
+            if (ndist >= here || ndist > best_dist)
+                continue;
+
+            if (npos != target && !mons_traversable(npos))
+                continue;
+
+            best_dir  = dir;
+            best_dist = ndist;
+        }
+
+        // The generic field doesn't describe this monster's movement;
+        // fall back to the full search.
+        if (best_dir == -1)
+            return false;
+
+        const coord_def npos = pos + Compass[best_dir];
+        prev[npos.x][npos.y] = (best_dir + 4) % 8;
+        pos = npos;
+    }
+
+#ifdef DEBUG_PATHFIND
+    mprf("Shared flood field path found (dist = %d).", field_dist);
+#endif
+    return true;
+}
+
 bool monster_pathfind::init_pathfind(coord_def src, coord_def dest, bool diag,
                                      bool msg)
 {
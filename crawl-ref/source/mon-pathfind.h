@@ -5,6 +5,8 @@ class monster;
 
 int mons_tracking_range(const monster* mon);
 
+void mons_path_invalidate_flood();
+
 class monster_pathfind
 {
 public:
@@ -25,6 +27,7 @@ public:
 
 protected:
     // protected methods
+    bool shared_flood_path();
     bool calc_path_to_neighbours();
     bool traversable(const coord_def& p);
     int  travel_cost(coord_def npos);
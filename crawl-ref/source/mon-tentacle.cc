@@ -1134,11 +1134,11 @@ void move_child_tentacles(monster* mons)
 
 static monster* _mons_get_parent_monster(monster* mons)
 {
-    for (monster_iterator mi; mi; ++mi)
-    {
-        if (mi->is_parent_monster_of(mons))
-            return *mi;
-    }
+    // The child stores its parent's mid, so there's no need to sweep
+    // every monster slot looking for the owner.
+    monster* parent = monster_by_mid(mons->tentacle_connect);
+    if (parent && parent->is_parent_monster_of(mons))
+        return parent;
 
     return nullptr;
 }
@@ -328,7 +328,7 @@ static resists_t _apply_holiness_resists(resists_t resists, mon_holy_type mh)
     return resists;
 }
 
-resists_t get_mons_class_resists(monster_type mc)
+static resists_t _get_mons_class_resists(monster_type mc)
 {
     const monsterentry *me = get_monster_data(mc);
     const resists_t resists = me ? me->resists
@@ -343,6 +343,24 @@ resists_t get_mons_class_resists(monster_type mc)
     return _apply_holiness_resists(resists, mons_class_holiness(mc));
 }
 
+resists_t get_mons_class_resists(monster_type mc)
+{
+    // Pure per class, and queried for every resistance check in combat,
+    // so resolve the whole table once.
+    static resists_t resolved[NUM_MONSTERS];
+    static bool init = false;
+    if (!init)
+    {
+        for (int i = 0; i < NUM_MONSTERS; ++i)
+            resolved[i] = _get_mons_class_resists((monster_type)i);
+        init = true;
+    }
+
+    if (mc < 0 || mc >= NUM_MONSTERS)
+        return _get_mons_class_resists(mc);
+    return resolved[mc];
+}
+
 resists_t get_mons_resists(const monster* mon)
 {
     get_tentacle_head(mon);
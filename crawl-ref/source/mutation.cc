@@ -43,6 +43,7 @@
 #include "stringutil.h"
 #include "transform.h"
 #include "unicode.h"
+#include "view.h"
 #include "viewchar.h"
 #include "xom.h"
 
@@ -234,6 +235,11 @@ bool is_body_facet(mutation_type mut)
 
 mutation_activity_type mutation_activity_level(mutation_type mut)
 {
+    // Nothing below suppresses anything in your normal form, and this
+    // gets asked for every mutation check in the game.
+    if (you.form == TRAN_NONE)
+        return MUTACT_FULL;
+
     // First make sure the player's form permits the mutation.
     if (!form_keeps_mutations())
     {
@@ -2600,7 +2606,10 @@ void check_monster_detect()
         if (!mon)
         {
             if (cell.detected_monster())
+            {
                 cell.clear_monster();
+                view_mark_dirty(*ri);
+            }
         }
         else if (!mons_is_firewood(mon))
         {
@@ -2620,6 +2629,7 @@ void check_monster_detect()
                                                         : MONS_SENSED;
 
                 env.map_knowledge(*ri).set_detected_monster(mc);
+                view_mark_dirty(*ri);
 
                 // Don't bother warning the player (or interrupting
                 // autoexplore) about monsters known to be easy or
@@ -187,8 +187,19 @@ COMPILE_CHECK(ARRAYSZ(species_order) <= NUM_SPECIES);
 
 bool is_starting_species(species_type species)
 {
-    return find(species_order, species_order + ARRAYSZ(species_order),
-                species) != species_order + ARRAYSZ(species_order);
+    // This runs for every cell whenever a newgame menu renders (and for
+    // every combo in the webtiles playability dump), so build a lookup
+    // once instead of scanning species_order each call.
+    static bool starting[NUM_SPECIES];
+    static bool init = false;
+    if (!init)
+    {
+        for (const species_type sp : species_order)
+            starting[sp] = true;
+        init = true;
+    }
+
+    return species >= 0 && species < NUM_SPECIES && starting[species];
 }
 
 static void _resolve_species(newgame_def* ng, const newgame_def* ng_choice)
@@ -123,6 +123,12 @@ public:
     // Clear all noise from the noise grid.
     void reset();
 
+    // Move the registered noises (and their source cells) into dest,
+    // leaving this grid clean. Only the source cells have been touched
+    // before propagation, so this avoids copying and then resetting the
+    // full grid for what is usually a handful of noises.
+    void transfer_to(noise_grid &dest);
+
     bool dirty() const { return !noises.empty(); }
 
 #ifdef DEBUG_NOISE_PROPAGATION
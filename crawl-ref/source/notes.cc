@@ -170,12 +170,15 @@ static bool _is_noteworthy(const Note& note)
     if (note.type == NOTE_DUNGEON_LEVEL_CHANGE)
         return _is_noteworthy_dlevel(note.place);
 
-    for (const Note &oldnote : note_list)
+    // The remaining types are deduplicated against earlier notes.  Walk
+    // the list newest first: the note list grows for the whole game, and
+    // the HP check only cares about recent notes anyway.
+    for (auto it = note_list.rbegin(); it != note_list.rend(); ++it)
     {
-        if (oldnote.type != note.type)
+        const Note& rnote(*it);
+        if (rnote.type != note.type)
             continue;
 
-        const Note& rnote(oldnote);
         switch (note.type)
         {
         case NOTE_GOD_POWER:
@@ -186,11 +189,10 @@ static bool _is_noteworthy(const Note& note)
         case NOTE_HP_CHANGE:
             // Not if we have a recent warning
             // unless we've lost half our HP since then.
-            if (note.turn - rnote.turn < 5
-                && note.first * 2 >= rnote.first)
-            {
+            if (note.turn - rnote.turn >= 5)
+                return true; // all earlier notes are older still
+            if (note.first * 2 >= rnote.first)
                 return false;
-            }
             break;
 
         default:
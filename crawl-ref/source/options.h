@@ -114,7 +114,9 @@ public:
     map<dungeon_feature_type, FixedVector<ucs_t, 2> > feature_symbol_overrides;
     map<monster_type, cglyph_t> mon_glyph_overrides;
     ucs_t cset_override[NUM_DCHAR_TYPES];
-    typedef pair<string, cglyph_t> item_glyph_override_type;
+    // Keyed by pattern rather than by the raw option string, so each
+    // pattern is compiled once and not per uncached item name.
+    typedef pair<text_pattern, cglyph_t> item_glyph_override_type;
     vector<item_glyph_override_type > item_glyph_overrides;
     map<string, cglyph_t> item_glyph_cache;
 
@@ -952,6 +952,12 @@ struct status_light
 
 static void _add_status_light_to_out(int i, vector<status_light>& out)
 {
+    // Inactive durations can't produce a light; don't bother building
+    // and filling a status_info for them. Most of the ~80 duration
+    // slots polled per redraw are inactive on any given turn.
+    if (i < NUM_DURATIONS && !you.duration[i])
+        return;
+
     status_info inf;
 
     if (fill_status_info(i, &inf) && !inf.light_text.empty())
@@ -1237,6 +1243,14 @@ void print_stats()
     cursor_control coff(false);
     textcolour(LIGHTGREY);
 
+    // The gold line has no redraw flag of its own and was rewritten on
+    // every call; cache what's on screen and rewrite only on change.
+    // Every full redraw sets redraw_title, which doubles as the
+    // "screen was clobbered" signal here.
+    static int gold_displayed = -1;
+    if (you.redraw_title)
+        gold_displayed = -1;
+
     // Displayed evasion is tied to dex/str.
     if (you.redraw_stats[STAT_DEX]
         || you.redraw_stats[STAT_STR])
@@ -1337,9 +1351,13 @@ void print_stats()
     {
         // Increase y-value for all following lines.
         yhack++;
-        CGOTOXY(1+6, 8 + yhack, GOTO_STAT);
-        textcolour(HUD_VALUE_COLOUR);
-        CPRINTF("%-6d", you.gold);
+        if (you.gold != gold_displayed)
+        {
+            CGOTOXY(1+6, 8 + yhack, GOTO_STAT);
+            textcolour(HUD_VALUE_COLOUR);
+            CPRINTF("%-6d", you.gold);
+            gold_displayed = you.gold;
+        }
     }
 
     if (you.wield_change)
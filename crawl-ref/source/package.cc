@@ -30,6 +30,9 @@ Notes:
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#ifdef UNIX
+#include <sys/mman.h>
+#endif
 
 #include "endianness.h"
 #include "errors.h"
@@ -83,6 +86,9 @@ package::package(const char* file, bool writeable, bool empty)
 #ifdef DO_FSYNC
     , tmp(false)
 #endif
+#ifdef UNIX
+    , map_base(0), map_len(0), map_failed(false)
+#endif
 {
     dprintf("package: initializing file=\"%s\" rw=%d\n", file, writeable);
     ASSERT(writeable || !empty);
@@ -130,6 +136,9 @@ package::package()
 #ifdef DO_FSYNC
     , tmp(true)
 #endif
+#ifdef UNIX
+    , map_base(0), map_len(0), map_failed(false)
+#endif
 {
     dprintf("package: initializing tmp file\n");
     filename = "[tmp]";
@@ -208,6 +217,16 @@ package::~package()
         // catching missing manual deletes.  The C++ exit handler is the
         // only place that can be legitimately call things in wrong order.
 
+#ifdef UNIX
+    // Unmap before a possible truncation shortens the file under the map.
+    if (map_base)
+    {
+        munmap(map_base, map_len);
+        map_base = 0;
+        map_len = 0;
+    }
+#endif
+
     if (rw && !aborted)
     {
         commit();
@@ -273,9 +292,50 @@ void package::seek(plen_t to)
         sysfail("failed to seek inside the save file");
 }
 
-chunk_writer* package::writer(const string name)
+// Returns a read-only view of a range of the save file, memory mapping the
+// file on first use and remapping it if it has grown since.  Writes done
+// through the file descriptor stay coherent with a MAP_SHARED mapping, so
+// readers may use views of any complete write.  Returns NULL if the range
+// isn't backed by the file yet or the platform can't map it; callers must
+// then fall back to read().
+const unsigned char *package::view(plen_t at, plen_t len)
 {
-    return new chunk_writer(this, name);
+#ifdef UNIX
+    if (aborted || map_failed)
+        return 0;
+    if (at + len > file_len)
+        corrupted("save file corrupted -- invalid offset");
+    if (at + len > map_len)
+    {
+        // file_len may run ahead of the bytes actually written; map only
+        // what's on disk so a stray access can't fault.
+        off_t size = lseek(fd, 0, SEEK_END);
+        if (size == -1)
+            sysfail("save file (%s) is not seekable", filename.c_str());
+        if (at + len > (plen_t)size)
+            return 0;
+        if (map_base)
+            munmap(map_base, map_len);
+        map_base = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (map_base == MAP_FAILED)
+        {
+            dprintf("package: mmap failed, falling back to plain reads\n");
+            map_base = 0;
+            map_len = 0;
+            map_failed = true;
+            return 0;
+        }
+        map_len = size;
+    }
+    return (const unsigned char*)map_base + at;
+#else
+    return 0;
+#endif
+}
+
+chunk_writer* package::writer(const string name, int compression)
+{
+    return new chunk_writer(this, name, compression);
 }
 
 chunk_reader* package::reader(const string name)
@@ -667,7 +727,8 @@ plen_t package::get_chunk_compressed_length(const string name)
     return len;
 }
 
-chunk_writer::chunk_writer(package *parent, const string _name)
+chunk_writer::chunk_writer(package *parent, const string _name,
+                           int compression)
     : first_block(0), cur_block(0), block_len(0)
 {
     ASSERT(parent);
@@ -687,7 +748,7 @@ chunk_writer::chunk_writer(package *parent, const string _name)
     zs.zalloc    = 0;
     zs.zfree     = 0;
     zs.opaque    = Z_NULL;
-    if (deflateInit(&zs, Z_DEFAULT_COMPRESSION))
+    if (deflateInit(&zs, compression))
         fail("save file compression failed during init: %s", zs.msg);
 #define ZB_SIZE 32768
     zs.next_out  = z_buffer = (Bytef*)malloc(ZB_SIZE);
@@ -898,6 +959,44 @@ plen_t chunk_reader::raw_read(void *data, plen_t len)
     return (char*)buf - (char*)data;
 }
 
+// Advances to the next contiguous fragment of the chunk and returns a
+// pointer to it inside the package's mapping of the save file, with the
+// fragment's length in *len.  Returns NULL when the file can't be mapped;
+// the caller then falls back to raw_read(), which continues from the same
+// position.
+const unsigned char *chunk_reader::raw_read_mapped(plen_t *len)
+{
+    if (!block_left)
+    {
+        if (!next_block)
+            corrupted("save file corrupted -- block truncated");
+
+        const unsigned char *hdr = pkg->view(next_block, sizeof(block_header));
+        if (!hdr)
+            return 0;
+
+        // Blocks sit at arbitrary offsets, so don't read the header in place.
+        block_header bl;
+        memcpy(&bl, hdr, sizeof(bl));
+
+        off = next_block + sizeof(block_header);
+        block_left = htole(bl.len);
+        next_block = htole(bl.next);
+        // This reeks of on-disk corruption (zeroed data).
+        if (!block_left)
+            corrupted("save file corrupted -- empty block");
+    }
+
+    const unsigned char *data = pkg->view(off, block_left);
+    if (!data)
+        return 0;
+
+    *len = block_left;
+    off += block_left;
+    block_left = 0;
+    return data;
+}
+
 plen_t chunk_reader::read(void *data, plen_t len)
 {
     ASSERT(data);
@@ -916,10 +1015,21 @@ plen_t chunk_reader::read(void *data, plen_t len)
     {
         if (!zs.avail_in)
         {
-            zs.next_in  = z_buffer;
-            zs.avail_in = raw_read(z_buffer, sizeof(z_buffer));
-            if (!zs.avail_in)
-                corrupted("save file corrupted -- block truncated");
+            // Inflate straight from the mapped save file when possible,
+            // skipping a copy through z_buffer.
+            plen_t mapped_len;
+            if (const unsigned char *mapped = raw_read_mapped(&mapped_len))
+            {
+                zs.next_in  = (Bytef*)mapped;
+                zs.avail_in = mapped_len;
+            }
+            else
+            {
+                zs.next_in  = z_buffer;
+                zs.avail_in = raw_read(z_buffer, sizeof(z_buffer));
+                if (!zs.avail_in)
+                    corrupted("save file corrupted -- block truncated");
+            }
         }
         int res = inflate(&zs, Z_NO_FLUSH);
         if (res == Z_STREAM_END)
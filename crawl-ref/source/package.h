@@ -35,7 +35,8 @@ private:
     void raw_write(const void *data, plen_t len);
     void finish_block(plen_t next);
 public:
-    chunk_writer(package *parent, const string _name);
+    chunk_writer(package *parent, const string _name,
+                 int compression = Z_DEFAULT_COMPRESSION);
     ~chunk_writer();
     void write(const void *data, plen_t len);
     friend class package;
@@ -55,6 +56,7 @@ private:
     Bytef z_buffer[32768];
 #endif
     plen_t raw_read(void *data, plen_t len);
+    const unsigned char *raw_read_mapped(plen_t *len);
 public:
     chunk_reader(package *parent, const string _name);
     ~chunk_reader();
@@ -69,7 +71,8 @@ public:
     package(const char* file, bool writeable, bool empty = false);
     package();
     ~package();
-    chunk_writer* writer(const string name);
+    chunk_writer* writer(const string name,
+                         int compression = Z_DEFAULT_COMPRESSION);
     chunk_reader* reader(const string name);
     void commit();
     void delete_chunk(const string name);
@@ -93,6 +96,11 @@ private:
     bool aborted;
 #ifdef DO_FSYNC
     bool tmp;
+#endif
+#ifdef UNIX
+    void *map_base;
+    plen_t map_len;
+    bool map_failed;
 #endif
     map<string, plen_t> directory;
     map<plen_t, plen_t> free_blocks;
@@ -109,6 +117,7 @@ private:
     void free_block_chain(plen_t at);
     void free_block(plen_t at, plen_t size);
     void seek(plen_t to);
+    const unsigned char *view(plen_t at, plen_t len);
     void fsck();
     void read_directory(plen_t start, uint8_t version);
     void trace_chunk(plen_t start);
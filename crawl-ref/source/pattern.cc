@@ -13,6 +13,8 @@
     #include <regex.h>
 #endif
 
+#include <algorithm>
+
 #include "pattern.h"
 
 #if defined(REGEX_PCRE)
@@ -106,6 +108,7 @@ const text_pattern &text_pattern::operator= (const text_pattern &tp)
     pattern = tp.pattern;
     compiled_pattern = nullptr;
     isvalid      = tp.isvalid;
+    literal      = false;
     ignore_case  = tp.ignore_case;
     return *this;
 }
@@ -120,6 +123,7 @@ const text_pattern &text_pattern::operator= (const string &spattern)
     pattern = spattern;
     compiled_pattern = nullptr;
     isvalid = true;
+    literal = false;
     // We don't change ignore_case
     return *this;
 }
@@ -132,14 +136,45 @@ bool text_pattern::operator== (const text_pattern &tp) const
     return pattern == tp.pattern && ignore_case == tp.ignore_case;
 }
 
+// Substring search for literal patterns, optionally case-blind.
+static bool _literal_match(const char *text, int length,
+                           const string &needle, bool icase)
+{
+    const char *end = text + length;
+    if (!icase)
+        return search(text, end, needle.begin(), needle.end()) != end;
+
+    return search(text, end, needle.begin(), needle.end(),
+                  [](char a, char b)
+                  {
+                      return tolower((unsigned char)a)
+                             == tolower((unsigned char)b);
+                  }) != end;
+}
+
 bool text_pattern::compile() const
 {
-    return !empty()?
-        !!(compiled_pattern = _compile_pattern(pattern.c_str(), ignore_case))
-      : false;
+    if (empty())
+        return false;
+
+    // Patterns with no regex metacharacters - the overwhelming bulk of
+    // force_more_message and message colour rules in rc files - don't
+    // need the regex engine at all: an unanchored literal matches iff
+    // it occurs as a substring.
+    if (!strpbrk(pattern.c_str(), "^$\\.[]()*+?|{}"))
+    {
+        literal = true;
+        return true;
+    }
+
+    return !!(compiled_pattern = _compile_pattern(pattern.c_str(), ignore_case));
 }
 
 bool text_pattern::matches(const char *s, int length) const
 {
-    return valid() && _pattern_match(compiled_pattern, s, length);
+    if (!valid())
+        return false;
+    if (literal)
+        return _literal_match(s, length, pattern, ignore_case);
+    return _pattern_match(compiled_pattern, s, length);
 }
@@ -16,13 +16,13 @@ class text_pattern : public base_pattern
 public:
     text_pattern(const string &s, bool icase = false)
         : pattern(s), compiled_pattern(nullptr),
-          isvalid(true), ignore_case(icase)
+          isvalid(true), literal(false), ignore_case(icase)
     {
     }
 
     text_pattern()
         : pattern(), compiled_pattern(nullptr),
-         isvalid(false), ignore_case(false)
+         isvalid(false), literal(false), ignore_case(false)
     {
     }
 
@@ -31,6 +31,7 @@ public:
           pattern(tp.pattern),
           compiled_pattern(nullptr),
           isvalid(tp.isvalid),
+          literal(false),
           ignore_case(tp.ignore_case)
     {
     }
@@ -46,7 +47,7 @@ public:
     bool valid() const
     {
         return isvalid
-            && (compiled_pattern || (isvalid = compile()));
+            && (compiled_pattern || literal || (isvalid = compile()));
     }
 
     bool matches(const char *s, int length) const;
@@ -70,6 +71,9 @@ private:
     string pattern;
     mutable void *compiled_pattern;
     mutable bool isvalid;
+    // Set by compile() for patterns with no regex metacharacters;
+    // matches() then does a plain substring search.
+    mutable bool literal;
     bool ignore_case;
 };
 #endif
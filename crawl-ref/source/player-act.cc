@@ -265,6 +265,104 @@ brand_type player::damage_brand(int)
     return get_form()->get_uc_brand();
 }
 
+// a semi-arbitrary multiplier, to minimize loss of precision from integer
+// math.
+static const int DELAY_SCALE = 20;
+
+// Attack delay distributions are composed from a handful of small
+// integers, and every step of the composition heap-allocates a weight
+// vector. The same few combinations recur on every swing and every UI
+// query of weapon speed, so the composed random_vars are memoised by
+// their ingredients below. The returned references stay valid until the
+// next call of the same helper; use them immediately.
+
+// Delay for forms that key off experience level rather than skill.
+static const random_var &_xl_attack_delay(int xl)
+{
+    static map<int, random_var> cache;
+    auto it = cache.find(xl);
+    if (it != cache.end())
+        return it->second;
+
+    const random_var delay =
+        rv::max(constant(10) - div_rand_round(constant(xl * 10), 54),
+                constant(3));
+    return cache.insert(make_pair(xl, delay)).first->second;
+}
+
+// Delay for unarmed and thrown attacks. The armour slowdown is rolled
+// by the caller (it's a plain integer die), so it arrives here as part
+// of the key.
+static const random_var &_unarmed_attack_delay(int base_delay, int skill10,
+                                               bool bat_form)
+{
+    static map<pair<pair<int, int>, int>, random_var> cache;
+    const auto key = make_pair(make_pair(base_delay, skill10), (int)bat_form);
+    auto it = cache.find(key);
+    if (it != cache.end())
+        return it->second;
+    if (cache.size() >= 1000)
+        cache.clear();
+
+    // Sped up by skill (min delay (10 - 270/54) = 5).
+    random_var delay = constant(base_delay)
+                       - div_rand_round(constant(skill10), 54);
+    // Bats are faster (for whatever good it does them).
+    if (bat_form)
+        delay = div_rand_round(delay * constant(3), 5);
+    delay = rv::max(delay, constant(3));
+    return cache.insert(make_pair(key, delay)).first->second;
+}
+
+// Delay for attacks with a melee weapon or launcher.
+static const random_var &_weapon_attack_delay(int base_speed, int skill10,
+                                              int min_delay, bool speed_brand)
+{
+    static map<pair<pair<int, int>, pair<int, int> >, random_var> cache;
+    const auto key = make_pair(make_pair(base_speed, skill10),
+                               make_pair(min_delay, (int)speed_brand));
+    auto it = cache.find(key);
+    if (it != cache.end())
+        return it->second;
+    if (cache.size() >= 1000)
+        cache.clear();
+
+    random_var delay = constant(base_speed)
+                       - div_rand_round(constant(skill10), DELAY_SCALE);
+    // apply minimum to weapon skill modification
+    delay = rv::max(delay, constant(min_delay));
+    if (speed_brand)
+        delay = div_rand_round(constant(2) * delay, 3);
+    // At the moment it never gets this low anyway.
+    delay = rv::max(delay, constant(3));
+    return cache.insert(make_pair(key, delay)).first->second;
+}
+
+static const random_var &_shield_attack_penalty(int base_penalty,
+                                                bool unarmed_bonus)
+{
+    static map<pair<int, int>, random_var> cache;
+    const auto key = make_pair(base_penalty, (int)unarmed_bonus);
+    auto it = cache.find(key);
+    if (it != cache.end())
+        return it->second;
+    if (cache.size() >= 1000)
+        cache.clear();
+
+    random_var penalty = constant(0);
+    // Calculate this separately to avoid overflowing the weights in
+    // the random_var.
+    if (base_penalty)
+    {
+        penalty = div_rand_round(rv::min(rv::roll_dice(1, base_penalty),
+                                         rv::roll_dice(1, base_penalty)),
+                                 DELAY_SCALE);
+    }
+    // Give unarmed shield-users a slight penalty always.
+    if (unarmed_bonus)
+        penalty += rv::random2(2);
+    return cache.insert(make_pair(key, penalty)).first->second;
+}
 
 /**
  * Return the delay caused by attacking with the provided weapon & projectile.
@@ -282,10 +380,8 @@ random_var player::attack_delay(const item_def *weap,
                                 const item_def *projectile, bool random,
                                 bool scaled, bool do_shield) const
 {
-    random_var attk_delay = constant(15);
-    // a semi-arbitrary multiplier, to minimize loss of precision from integer
-    // math.
-    const int DELAY_SCALE = 20;
+    static const random_var fallback_delay = constant(15);
+    const random_var *attk_delay = &fallback_delay;
     const int armour_penalty = adjusted_body_armour_penalty(DELAY_SCALE);
     const int base_shield_penalty = adjusted_shield_penalty(DELAY_SCALE);
 
@@ -297,24 +393,17 @@ random_var player::attack_delay(const item_def *weap,
     if (!check_weapon)
     {
         if (form_uses_xl())
-        {
-            attk_delay =
-                constant(10)
-                - div_rand_round(constant(you.experience_level * 10), 54);
-        }
+            attk_delay = &_xl_attack_delay(you.experience_level);
         else
         {
             // UC/throwing attacks are slowed by heavy armour (aevp)
-            attk_delay = max(10, 7 + div_rand_round(armour_penalty,
-                                                    DELAY_SCALE));
+            const int base_delay = max(10, 7 + div_rand_round(armour_penalty,
+                                                              DELAY_SCALE));
 
-            // ...and sped up by skill (min delay (10 - 270/54) = 5)
             skill_type sk = projectile ? SK_THROWING : SK_UNARMED_COMBAT;
-            attk_delay -= div_rand_round(constant(you.skill(sk, 10)), 54);
-
-            // Bats are faster (for whatever good it does them).
-            if (you.form == TRAN_BAT && !projectile)
-                attk_delay = div_rand_round(attk_delay * constant(3), 5);
+            attk_delay = &_unarmed_attack_delay(base_delay, you.skill(sk, 10),
+                                                you.form == TRAN_BAT
+                                                && !projectile);
         }
     }
     else
@@ -325,44 +414,28 @@ random_var player::attack_delay(const item_def *weap,
                    && is_launched(this, weap, *projectile) == LRET_LAUNCHED))
         {
             const skill_type wpn_skill = item_attack_skill(*weap);
-            attk_delay = constant(property(*weap, PWPN_SPEED));
-            attk_delay -=
-                div_rand_round(constant(you.skill(wpn_skill, 10)),
-                               DELAY_SCALE);
-
-            // apply minimum to weapon skill modification
-            attk_delay = rv::max(attk_delay, weapon_min_delay(*weap));
-
-            if (weap->base_type == OBJ_WEAPONS
-                && get_weapon_brand(*weap) == SPWPN_SPEED)
-            {
-                attk_delay = div_rand_round(constant(2) * attk_delay, 3);
-            }
+            attk_delay =
+                &_weapon_attack_delay(property(*weap, PWPN_SPEED),
+                                      you.skill(wpn_skill, 10),
+                                      weapon_min_delay(*weap),
+                                      weap->base_type == OBJ_WEAPONS
+                                      && get_weapon_brand(*weap)
+                                         == SPWPN_SPEED);
         }
     }
 
-    // At the moment it never gets this low anyway.
-    attk_delay = rv::max(attk_delay, constant(3));
-
-    // Calculate this separately to avoid overflowing the weights in
-    // the random_var.
-    random_var shield_penalty = constant(0);
-    if (base_shield_penalty)
+    static const random_var no_penalty = constant(0);
+    const random_var *shield_penalty = &no_penalty;
+    if (do_shield)
     {
         shield_penalty =
-            div_rand_round(rv::min(rv::roll_dice(1, base_shield_penalty),
-                                   rv::roll_dice(1, base_shield_penalty)),
-                           DELAY_SCALE);
+            &_shield_attack_penalty(base_shield_penalty,
+                                    !weap
+                                    && player_wearing_slot(EQ_SHIELD));
     }
-    // Give unarmed shield-users a slight penalty always.
-    if (!weap && player_wearing_slot(EQ_SHIELD))
-        shield_penalty += rv::random2(2);
-
-    if (!do_shield)
-        shield_penalty = constant(0);
 
-    int final_delay = random ? attk_delay.roll() + shield_penalty.roll()
-                             : attk_delay.max() + shield_penalty.max();
+    int final_delay = random ? attk_delay->roll() + shield_penalty->roll()
+                             : attk_delay->max() + shield_penalty->max();
     // Stop here if we just want the unmodified value.
     if (!scaled)
         return final_delay;
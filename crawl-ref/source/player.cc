@@ -3686,10 +3686,9 @@ int check_stealth()
     stealth += STEALTH_PIP * you.wearing(EQ_RINGS, RING_STEALTH);
     stealth -= STEALTH_PIP * you.wearing(EQ_RINGS, RING_LOUDNESS);
 
-    const item_def *body_armour = you.slot_item(EQ_BODY_ARMOUR);
-    if (body_armour)
+    if (arm)
     {
-        const int pips = armour_type_prop(body_armour->sub_type, ARMF_STEALTH);
+        const int pips = armour_type_prop(arm->sub_type, ARMF_STEALTH);
         stealth += pips * STEALTH_PIP;
     }
 
@@ -4206,7 +4205,18 @@ unsigned int exp_needed(int lev, int exp_apt)
     if (exp_apt == -99)
         exp_apt = species_exp_modifier(you.species);
 
-    return (unsigned int) ((level - 1) * exp(-log(2.0) * (exp_apt - 1) / 4));
+    // The aptitude factor 2^(-(apt - 1)/4) is the only non-trivial
+    // arithmetic here, and the aptitude barely ever changes; remember
+    // the last one rather than paying for exp() on every XP event.
+    static int cached_apt = -99;
+    static double apt_factor = 1.0;
+    if (exp_apt != cached_apt)
+    {
+        apt_factor = exp(-log(2.0) * (exp_apt - 1) / 4);
+        cached_apt = exp_apt;
+    }
+
+    return (unsigned int) ((level - 1) * apt_factor);
 }
 
 // returns bonuses from rings of slaying, etc.
@@ -8690,7 +8700,7 @@ string temperature_text(int temp)
 void player_open_door(coord_def doorpos)
 {
     // Finally, open the closed door!
-    set<coord_def> all_door;
+    coord_set all_door;
     find_connected_identical(doorpos, all_door);
     const char *adj, *noun;
     get_door_description(all_door.size(), &adj, &noun);
@@ -8864,7 +8874,7 @@ void player_close_door(coord_def doorpos)
                                                 "door_description_adjective");
     const string door_desc_noun = env.markers.property_at(doorpos, MAT_ANY,
                                                 "door_description_noun");
-    set<coord_def> all_door;
+    coord_set all_door;
     find_connected_identical(doorpos, all_door);
     const char *adj, *noun;
     get_door_description(all_door.size(), &adj, &noun);
@@ -403,6 +403,8 @@ void player_quiver::_get_fire_order(vector<int>& order,
         return;
     }
 
+    const item_def *weapon = you.weapon();
+
     for (int i_inv = inv_start; i_inv < ENDOFPACK; i_inv++)
     {
         const item_def& item = you.inv[i_inv];
@@ -410,11 +412,12 @@ void player_quiver::_get_fire_order(vector<int>& order,
             continue;
 
         // Don't do anything if this item is not really fit for throwing.
-        if (is_launched(&you, you.weapon(), item) == LRET_FUMBLED)
+        if (is_launched(&you, weapon, item) == LRET_FUMBLED)
             continue;
 
         // =f prevents item from being in fire order.
         if (!ignore_inscription_etc
+            && !item.inscription.empty()
             && strstr(item.inscription.c_str(), manual ? "=F" : "=f"))
         {
             continue;
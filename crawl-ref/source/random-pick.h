@@ -37,6 +37,15 @@ public:
     int rarity_at(const random_pick_entry<T> *pop,
                   int depth);
     virtual bool veto(T val) { return false; }
+
+protected:
+    struct pick_entry
+    {
+        T value;
+        int rarity;
+    };
+    const vector<pick_entry> &depth_candidates(
+        const random_pick_entry<T> *weights, int level);
 };
 
 template <typename T, int max>
@@ -44,28 +53,59 @@ random_picker<T, max>::~random_picker()
 {
 }
 
+// Collect the entries valid at this level, with their interpolated
+// rarities.  These depend only on the weights list and the level, not on
+// the individual pick, so they are worked out once per (list, level) and
+// memoised; vetoes are applied per pick in pick() below.  The weights
+// list must point at static data, as the cache is keyed by its address.
 template <typename T, int max>
-T random_picker<T, max>::pick(const random_pick_entry<T> *weights, int level,
-                              T none)
+const vector<typename random_picker<T, max>::pick_entry> &
+random_picker<T, max>::depth_candidates(const random_pick_entry<T> *weights,
+                                        int level)
 {
-    struct { T value; int rarity; } valid[max];
-    int nvalid = 0;
-    int totalrar = 0;
+    static map<pair<const random_pick_entry<T> *, int>,
+               vector<pick_entry> > cache;
+    if (cache.size() >= 1000)
+        cache.clear();
+
+    auto result = cache.insert(make_pair(make_pair(weights, level),
+                                         vector<pick_entry>()));
+    vector<pick_entry> &cands = result.first->second;
+    if (!result.second)
+        return cands;
 
     for (const random_pick_entry<T> *pop = weights; pop->rarity; pop++)
     {
         if (level < pop->minr || level > pop->maxr)
             continue;
 
-        if (veto(pop->value))
-            continue;
-
         int rar = rarity_at(pop, level);
         ASSERTM(rar > 0, "Rarity %d: %d at level %d", rar, pop->value, level);
 
-        valid[nvalid].value = pop->value;
-        valid[nvalid].rarity = rar;
-        totalrar += rar;
+        cands.push_back(pick_entry{pop->value, rar});
+    }
+
+    return cands;
+}
+
+template <typename T, int max>
+T random_picker<T, max>::pick(const random_pick_entry<T> *weights, int level,
+                              T none)
+{
+    const vector<pick_entry> &cands = depth_candidates(weights, level);
+
+    struct { T value; int rarity; } valid[max];
+    int nvalid = 0;
+    int totalrar = 0;
+
+    for (const pick_entry &cand : cands)
+    {
+        if (veto(cand.value))
+            continue;
+
+        valid[nvalid].value = cand.value;
+        valid[nvalid].rarity = cand.rarity;
+        totalrar += cand.rarity;
         nvalid++;
     }
 
@@ -17,10 +17,90 @@
 
 #include "syscalls.h"
 
+// Small-state generator (xoroshiro128+, Blackman & Vigna) for bulk,
+// statistically-uncritical uses: its whole state fits in one cache
+// line, unlike a Mersenne twist, which matters in tight procedural
+// loops. It is deliberately separate from the mt_rng streams so that
+// code switching over to it can't perturb reproducible gameplay
+// randomness.
+static uint64_t _bulk_state[2] =
+{
+    0x9e3779b97f4a7c15ULL, 0xbf58476d1ce4e5b9ULL,
+};
+
+static inline uint64_t _rotl64(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+void seed_bulk_rng(uint32_t seed)
+{
+    // Spread the seed over the full state with splitmix64.
+    uint64_t z = seed;
+    for (int i = 0; i < 2; i++)
+    {
+        z += 0x9e3779b97f4a7c15ULL;
+        uint64_t s = z;
+        s = (s ^ (s >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        s = (s ^ (s >> 27)) * 0x94d049bb133111ebULL;
+        _bulk_state[i] = s ^ (s >> 31);
+    }
+}
+
+uint32_t bulk_random_int()
+{
+    const uint64_t s0 = _bulk_state[0];
+    uint64_t s1 = _bulk_state[1];
+    // The low bits of xoroshiro128+ are its weakest, so hand out the
+    // high word.
+    const uint32_t result = (uint32_t)((s0 + s1) >> 32);
+
+    s1 ^= s0;
+    _bulk_state[0] = _rotl64(s0, 55) ^ s1 ^ (s1 << 14);
+    _bulk_state[1] = _rotl64(s1, 36);
+
+    return result;
+}
+
+// [0, max), like random2(), but on the bulk stream. Uses a fixed-point
+// multiply instead of rejection sampling; the tiny bias (< 1 in 2^32 /
+// max) is irrelevant for the uses this stream is meant for.
+int bulk_random2(int max)
+{
+    if (max <= 1)
+        return 0;
+
+    return (int)(((uint64_t)bulk_random_int() * max) >> 32);
+}
+
+// Fill a buffer with words from the bulk stream in one pass, so
+// grid-scale randomized passes can draw all their numbers up front
+// instead of paying a call per cell.
+void bulk_random_fill(uint32_t *dest, int count)
+{
+    for (int i = 0; i < count; i++)
+        dest[i] = bulk_random_int();
+}
+
+// Batch x_chance_in_y() on the bulk stream: dest[i] is true with
+// probability x in y, independently for each of count entries.
+void bulk_x_chance_in_y(int x, int y, bool *dest, int count)
+{
+    if (x <= 0 || x >= y)
+    {
+        fill(dest, dest + count, x > 0 && x >= y);
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+        dest[i] = bulk_random2(y) < x;
+}
+
 void seed_rng(uint32_t seed)
 {
     mt_rng[0].init(seed);
     mt_rng[1].charge(&mt_rng[0]);
+    seed_bulk_rng(seed);
 }
 
 void seed_rng()
@@ -37,6 +117,7 @@ void seed_rng()
 
     mt_rng[0].init_array(seed_key, 624);
     mt_rng[1].charge(&mt_rng[0]);
+    seed_bulk_rng(seed_key[0] ^ seed_key[1]);
 }
 
 uint32_t get_uint32() {
@@ -17,6 +17,15 @@ void seed_rng(uint32_t seed);
 uint32_t get_uint32();
 uint32_t get_uint32(int rng);
 
+// A cheap small-state generator for statistically-uncritical hot
+// loops; see random.cc. Not for anything that must stay in sync with
+// the main gameplay streams.
+void seed_bulk_rng(uint32_t seed);
+uint32_t bulk_random_int();
+int bulk_random2(int max);
+void bulk_random_fill(uint32_t *dest, int count);
+void bulk_x_chance_in_y(int x, int y, bool *dest, int count);
+
 bool coinflip();
 int div_rand_round(int num, int den);
 int div_round_up(int num, int den);
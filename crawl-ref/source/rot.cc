@@ -168,14 +168,17 @@ static bool _item_needs_rot_check(const item_def &item)
     if (!item.defined())
         return false;
 
-    if (item.props.exists(CORPSE_NEVER_DECAYS))
+    // Check the type fields first: props.exists() is a string-keyed
+    // map lookup, and the overwhelming majority of items can never
+    // rot, so don't pay it for them on every decay sweep.
+    if (!is_perishable_stack(item)
+        && !(item.base_type == OBJ_CORPSES
+             && item.sub_type <= CORPSE_SKELETON)) // XXX: is this needed?
+    {
         return false;
+    }
 
-    if (is_perishable_stack(item))
-        return true;
-
-    return item.base_type == OBJ_CORPSES
-           && item.sub_type <= CORPSE_SKELETON; // XXX: is this needed?
+    return !item.props.exists(CORPSE_NEVER_DECAYS);
 }
 
 /**
@@ -329,13 +332,14 @@ void rot_floor_items(int elapsedTime)
         return;
 
     const int rot_time = elapsedTime / ROT_TIME_FACTOR;
+    const bool gozag = you_worship(GOD_GOZAG);
 
     for (int mitm_index = 0; mitm_index < MAX_ITEMS; ++mitm_index)
     {
         item_def &it = mitm[mitm_index];
 
         // XXX move this somewhere more reasonable?
-        if (you_worship(GOD_GOZAG) && it.base_type == OBJ_GOLD)
+        if (gozag && it.base_type == OBJ_GOLD)
         {
             _rot_floor_gold(it, rot_time);
             continue;
@@ -262,14 +262,25 @@ static int _shop_get_item_value(const item_def& item, int greed, bool id)
     return max(result, 1);
 }
 
+// Prices for the current shop's stock, refreshed once per menu redraw.
+// item_value() walks artefact properties, so don't recompute it for
+// every sort comparison and affordability check.
+static vector<int> stock_cost;
+
+static void _shop_refresh_stock_costs(const shop_struct &shop, bool id)
+{
+    stock_cost.clear();
+    for (const item_def &item : shop.stock)
+        stock_cost.push_back(_shop_get_item_value(item, shop.greed, id));
+}
+
 // Comparator for sorting a permutation list according to the shop, the
 // original list of item IDs, and the current ordering mode.
 class ShopSorter
 {
 public:
     ShopSorter(const shop_struct &shop)
-        : stock(shop.stock), id(shoptype_identifies_stock(shop.type)),
-          greed(shop.greed)
+        : stock(shop.stock), id(shoptype_identifies_stock(shop.type))
     {}
 
     bool operator()(int a_index, int b_index) const
@@ -282,8 +293,7 @@ public:
         case ORDER_MODE_PRICE:
             // Greed will affect all items equally (other than rounding
             // error), so don't bother taking the shop's actual greed level.
-            return _shop_get_item_value(a, greed, id)
-                   < _shop_get_item_value(b, greed, id);
+            return stock_cost[a_index] < stock_cost[b_index];
         case ORDER_MODE_ALPHABETICAL:
             return a.name(DESC_PLAIN, false, id)
                    < b.name(DESC_PLAIN, false, id);
@@ -300,7 +310,6 @@ public:
 private:
     const vector<item_def>& stock;
     const bool id;
-    const int greed;
 };
 
 // Index into shop.stock from the letters in the shopping menu.
@@ -331,7 +340,7 @@ static void _shop_print_stock(const vector<bool>& selected,
     {
         const int stock_pos = stock_order[i];
         const item_def& item = shop.stock[stock_pos];
-        const int gp_value = _shop_get_item_value(item, shop.greed, id);
+        const int gp_value = stock_cost[stock_pos];
         const bool can_afford = (you.gold >= gp_value);
 
         cgotoxy(1, i + 1, GOTO_CRT);
@@ -470,6 +479,8 @@ static bool _in_a_shop(int shopidx, int &num_in_list)
 
         StashTrack.get_shop(shop.pos).reset();
 
+        _shop_refresh_stock_costs(shop, id_stock);
+
         in_list.clear();
         in_list.resize(shop.stock.size(), false);
         for (size_t i = 0; i < shop.stock.size(); i++)
@@ -495,8 +506,7 @@ static bool _in_a_shop(int shopidx, int &num_in_list)
                 num_in_list++;
             if (selected[i])
             {
-                total_cost += _shop_get_item_value(shop.stock[i],
-                                                   shop.greed, id_stock);
+                total_cost += stock_cost[i];
                 num_selected++;
             }
         }
@@ -531,8 +541,7 @@ static bool _in_a_shop(int shopidx, int &num_in_list)
             for (size_t i = 0; i < shop.stock.size(); i++)
             {
                 const item_def& item = shop.stock[i];
-                const int cost = _shop_get_item_value(item, shop.greed,
-                                                      id_stock);
+                const int cost = stock_cost[i];
 
                 unsigned int num = shopping_list.cull_identical_items(item,
                                                                       cost);
@@ -634,16 +643,8 @@ static bool _in_a_shop(int shopidx, int &num_in_list)
                     to_buy = in_list;
 
                     for (size_t i = 0; i < to_buy.size(); i++)
-                    {
                         if (to_buy[i])
-                        {
-                            const item_def& item = shop.stock[i];
-
-                            total_purchase +=
-                                _shop_get_item_value(item, shop.greed,
-                                                     id_stock);
-                        }
-                    }
+                            total_purchase += stock_cost[i];
                 }
             }
             else
@@ -754,11 +755,7 @@ static bool _in_a_shop(int shopidx, int &num_in_list)
                     if (selected[i])
                     {
                         if (!shopping_list.is_on_list(item))
-                        {
-                            const int cost = _shop_get_item_value(item,
-                                        shop.greed, id_stock);
-                            shopping_list.add_thing(item, cost);
-                        }
+                            shopping_list.add_thing(item, stock_cost[i]);
                         in_list[i]  = true;
                         selected[i] = false;
                     }
@@ -776,8 +773,7 @@ static bool _in_a_shop(int shopidx, int &num_in_list)
                         in_list[i]  = false;
                         selected[i] = true;
 
-                        total_cost += _shop_get_item_value(item, shop.greed,
-                                                           id_stock);
+                        total_cost += stock_cost[i];
 
                         if (shopping_list.is_on_list(item))
                             shopping_list.del_thing(item);
@@ -841,9 +837,7 @@ static bool _in_a_shop(int shopidx, int &num_in_list)
                 else if (to_shoplist)
                 {
                     selected[key] = false;
-                    const int cost = _shop_get_item_value(item, shop.greed,
-                                                          id_stock);
-                    shopping_list.add_thing(item, cost);
+                    shopping_list.add_thing(item, stock_cost[key]);
                 }
                 else
                     selected[key] = !selected[key];
@@ -755,9 +755,9 @@ void apply_noises()
     // middle of propagate_noise().
     if (_noise_grid.dirty())
     {
-        noise_grid copy = _noise_grid;
+        noise_grid copy;
         // Reset the main grid.
-        _noise_grid.reset();
+        _noise_grid.transfer_to(copy);
         copy.propagate_noise();
     }
 }
@@ -981,6 +981,19 @@ void noise_grid::reset()
     affected_actor_count = 0;
 }
 
+void noise_grid::transfer_to(noise_grid &dest)
+{
+    for (const noise_t &noise : noises)
+    {
+        dest.cells(noise.noise_source) = cells(noise.noise_source);
+        cells(noise.noise_source) = noise_cell();
+    }
+    dest.noises.swap(noises);
+    noises.clear();
+    dest.affected_actor_count = affected_actor_count;
+    affected_actor_count = 0;
+}
+
 void noise_grid::register_noise(const noise_t &noise)
 {
     noise_cell &target_cell(cells(noise.noise_source));
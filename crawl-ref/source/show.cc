@@ -26,6 +26,7 @@
 #endif
 #include "traps.h"
 #include "travel.h"
+#include "view.h"
 #include "viewgeom.h"
 #include "viewmap.h"
 
@@ -517,6 +518,8 @@ static void _update_monster(monster* mons)
 **/
 void show_update_at(const coord_def &gp, bool terrain_only)
 {
+    travel_distance_map_invalidate();
+
     if (you.see_cell(gp))
         env.map_knowledge(gp).clear_data();
     else if (!env.map_knowledge(gp).known())
@@ -552,6 +555,7 @@ void show_update_at(const coord_def &gp, bool terrain_only)
 #ifdef USE_TILE_WEB
     tiles.mark_for_redraw(gp);
 #endif
+    view_mark_dirty(gp);
 }
 
 void show_init(bool terrain_only)
@@ -262,10 +262,9 @@ static cglyph_t _get_item_override(const item_def &item)
             return *gly;
     }
 
-    for (auto ir : Options.item_glyph_overrides)
+    for (const auto &ir : Options.item_glyph_overrides)
     {
-        text_pattern tpat(ir.first);
-        if (tpat.matches(name))
+        if (ir.first.matches(name))
         {
             // You may have a rule that sets the glyph but not colour for
             // axes, then another that sets colour only for artefacts
@@ -475,10 +474,18 @@ static cglyph_t _get_cell_glyph_with_class(const map_cell& cell,
 
 cglyph_t get_cell_glyph(const coord_def& loc, bool only_stationary_monsters,
                         int colour_mode)
+{
+    return get_cell_glyph(env.map_knowledge(loc), loc,
+                          only_stationary_monsters, colour_mode);
+}
+
+// For callers that have already fetched the map_cell, e.g. when drawing
+// a screenful of map knowledge at a time.
+cglyph_t get_cell_glyph(const map_cell& cell, const coord_def& loc,
+                        bool only_stationary_monsters, int colour_mode)
 {
     // note: this does NOT determine output of the player glyph;
     // that's handled by itself in _draw_player() in view.cc
-    const map_cell& cell = env.map_knowledge(loc);
     const show_class cell_show_class =
         get_cell_show_class(cell, only_stationary_monsters);
     return _get_cell_glyph_with_class(cell, loc, cell_show_class, colour_mode);
@@ -719,11 +719,18 @@ bool check_selected_skills()
  */
 void reset_training()
 {
+    // Answer "is this skill trained?" once per skill up front; the queue
+    // loops below ask it for each of the couple of hundred entries, and
+    // this runs after every practise event.
+    FixedVector<bool, NUM_SKILLS> trained;
+    for (int i = 0; i < NUM_SKILLS; ++i)
+        trained[i] = skill_trained(i);
+
     // We clear the values in the training array. In auto mode they are set
     // to 0 (and filled later with the content of the queue), in manual mode,
     // the trainable ones are set to 1 (or 2 for focus).
     for (int i = 0; i < NUM_SKILLS; ++i)
-        if (you.auto_training || !skill_trained(i))
+        if (you.auto_training || !trained[i])
             you.training[i] = 0;
         else
             you.training[i] = you.train[i];
@@ -733,7 +740,7 @@ void reset_training()
     if (you.auto_training)
     {
         for (auto sk : you.exercises)
-            if (skill_trained(sk))
+            if (trained[sk])
             {
                 you.training[sk] += you.train[sk];
                 empty = false;
@@ -743,7 +750,7 @@ void reset_training()
         FixedVector<unsigned int, NUM_SKILLS> exer_all;
         exer_all.init(0);
         for (auto sk : you.exercises_all)
-            if (skill_trained(sk))
+            if (trained[sk])
             {
                 exer_all[sk] += you.train[sk];
                 empty = false;
@@ -758,7 +765,7 @@ void reset_training()
         if (empty)
         {
             for (int sk = 0; sk < NUM_SKILLS; ++sk)
-                if (skill_trained(sk))
+                if (trained[sk])
                     you.training[sk] = you.train[sk];
         }
 
@@ -773,7 +780,7 @@ void reset_training()
 
 void exercise(skill_type exsk, int deg)
 {
-    if (you.skills[exsk] >= 27)
+    if (you.skills[exsk] >= 27 || deg <= 0)
         return;
 
     dprf(DIAG_SKILLS, "Exercise %s by %d.", skill_name(exsk), deg);
@@ -1546,7 +1553,17 @@ int skill_bump(skill_type skill, int scale)
 
 static float _apt_to_factor(int apt)
 {
-    return 1 / exp(log(2) * apt / APT_DOUBLE);
+    // This ends up in every skill_exp_needed() call, which player::skill()
+    // loops over for each to-hit and damage calculation, so don't pay for
+    // the transcendentals more than once per distinct aptitude.
+    static map<int, float> factors;
+    map<int, float>::iterator it = factors.find(apt);
+    if (it != factors.end())
+        return it->second;
+
+    const float factor = 1 / exp(log(2) * apt / APT_DOUBLE);
+    factors[apt] = factor;
+    return factor;
 }
 
 unsigned int skill_exp_needed(int lev, skill_type sk, species_type sp)
@@ -1590,26 +1607,38 @@ float species_apt_factor(skill_type sk, species_type sp)
     return _apt_to_factor(species_apt(sk, sp));
 }
 
-vector<skill_type> get_crosstrain_skills(skill_type sk)
+const vector<skill_type>& get_crosstrain_skills(skill_type sk)
 {
+    // Return references into static tables: this is called from
+    // player::skill() and so sits on the combat fast path, where
+    // building a fresh vector per query shows up.
+    static const vector<skill_type> short_blades = { SK_LONG_BLADES };
+    static const vector<skill_type> long_blades  = { SK_SHORT_BLADES };
+    static const vector<skill_type> axes_staves  = { SK_POLEARMS,
+                                                     SK_MACES_FLAILS };
+    static const vector<skill_type> maces_pole   = { SK_AXES, SK_STAVES };
+    static const vector<skill_type> slings       = { SK_THROWING };
+    static const vector<skill_type> throwing     = { SK_SLINGS };
+    static const vector<skill_type> none;
+
     switch (sk)
     {
     case SK_SHORT_BLADES:
-        return { SK_LONG_BLADES };
+        return short_blades;
     case SK_LONG_BLADES:
-        return { SK_SHORT_BLADES };
+        return long_blades;
     case SK_AXES:
     case SK_STAVES:
-        return { SK_POLEARMS, SK_MACES_FLAILS };
+        return axes_staves;
     case SK_MACES_FLAILS:
     case SK_POLEARMS:
-        return { SK_AXES, SK_STAVES };
+        return maces_pole;
     case SK_SLINGS:
-        return { SK_THROWING };
+        return slings;
     case SK_THROWING:
-        return { SK_SLINGS };
+        return throwing;
     default:
-        return {};
+        return none;
     }
 }
 
@@ -647,37 +647,47 @@ bool has_spells_to_memorise(bool silent, spell_type current_spell)
                          silent, (spell_type) current_spell);
 }
 
-static bool _sort_mem_spells(spell_type a, spell_type b)
+static void _sort_mem_spells(vector<spell_type> &spells)
 {
-    // List the Vehumet gifts at the very top.
-    bool offering_a = vehumet_is_offering(a);
-    bool offering_b = vehumet_is_offering(b);
-    if (offering_a != offering_b)
-        return offering_a;
-
-    // List spells we can memorize right away first.
-    if (player_spell_levels() >= spell_levels_required(a)
-        && player_spell_levels() < spell_levels_required(b))
-    {
-        return true;
-    }
-    else if (player_spell_levels() < spell_levels_required(a)
-             && player_spell_levels() >= spell_levels_required(b))
-    {
-        return false;
-    }
+    // The failure rate reads the entire set of skills and enhancers; the
+    // comparator would recompute it O(n log n) times, so look each
+    // spell's sort keys up once instead.
+    const int avail_levels = player_spell_levels();
+    map<spell_type, int> fail_rate;
+    for (spell_type spell : spells)
+        fail_rate[spell] = failure_rate_to_int(raw_spell_fail(spell));
+
+    sort(spells.begin(), spells.end(),
+         [&avail_levels, &fail_rate](spell_type a, spell_type b)
+    {
+        // List the Vehumet gifts at the very top.
+        bool offering_a = vehumet_is_offering(a);
+        bool offering_b = vehumet_is_offering(b);
+        if (offering_a != offering_b)
+            return offering_a;
+
+        // List spells we can memorize right away first.
+        if (avail_levels >= spell_levels_required(a)
+            && avail_levels < spell_levels_required(b))
+        {
+            return true;
+        }
+        else if (avail_levels < spell_levels_required(a)
+                 && avail_levels >= spell_levels_required(b))
+        {
+            return false;
+        }
 
-    // Don't sort by failure rate beyond what the player can see in the
-    // success descriptions.
-    const int fail_rate_a = failure_rate_to_int(raw_spell_fail(a));
-    const int fail_rate_b = failure_rate_to_int(raw_spell_fail(b));
-    if (fail_rate_a != fail_rate_b)
-        return fail_rate_a < fail_rate_b;
+        // Don't sort by failure rate beyond what the player can see in the
+        // success descriptions.
+        if (fail_rate[a] != fail_rate[b])
+            return fail_rate[a] < fail_rate[b];
 
-    if (spell_difficulty(a) != spell_difficulty(b))
-        return spell_difficulty(a) < spell_difficulty(b);
+        if (spell_difficulty(a) != spell_difficulty(b))
+            return spell_difficulty(a) < spell_difficulty(b);
 
-    return strcasecmp(spell_title(a), spell_title(b)) < 0;
+        return strcasecmp(spell_title(a), spell_title(b)) < 0;
+    });
 }
 
 vector<spell_type> get_mem_spell_list(vector<int> &books)
@@ -692,7 +702,7 @@ vector<spell_type> get_mem_spell_list(vector<int> &books)
     if (!_get_mem_list(mem_spells, book_hash, num_unreadable, num_race))
         return spells;
 
-    sort(mem_spells.begin(), mem_spells.end(), _sort_mem_spells);
+    _sort_mem_spells(mem_spells);
 
     for (spell_type spell : mem_spells)
     {
@@ -708,7 +718,7 @@ static spell_type _choose_mem_spell(spell_list &spells,
                                     unsigned int num_unreadable,
                                     unsigned int num_race)
 {
-    sort(spells.begin(), spells.end(), _sort_mem_spells);
+    _sort_mem_spells(spells);
 
 #ifdef USE_TILE_LOCAL
     const bool text_only = false;
@@ -2784,9 +2784,16 @@ static bool _dazzle_can_hit(const actor *act)
     if (act->is_monster())
     {
         const monster* mons = act->as_monster();
-        bolt testbeam;
-        testbeam.thrower = KILL_YOU;
-        zappy(ZAP_DAZZLING_SPRAY, 100, testbeam);
+        // The same test beam serves for every candidate; no point
+        // rebuilding a bolt and rerunning zappy() per actor checked.
+        static bolt testbeam;
+        static bool testbeam_set = false;
+        if (!testbeam_set)
+        {
+            testbeam.thrower = KILL_YOU;
+            zappy(ZAP_DAZZLING_SPRAY, 100, testbeam);
+            testbeam_set = true;
+        }
 
         return !mons_is_avatar(mons->type)
                && mons_species(mons->type) != MONS_BUSH
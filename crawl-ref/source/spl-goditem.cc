@@ -484,6 +484,7 @@ int detect_items(int pow)
         {
             items_found++;
             env.map_knowledge(*ri).set_detected_item();
+            view_mark_dirty(*ri);
         }
     }
 
@@ -549,6 +550,7 @@ static bool _mark_detected_creature(coord_def where, monster* mon,
     }
 
     env.map_knowledge(where).set_detected_monster(mons_detected_base(mon->type));
+    view_mark_dirty(where);
 
     return found_good;
 }
@@ -3583,14 +3583,16 @@ void summoned_monster(const monster *mons, const actor *caster,
     int count = 1;
     for (monster_iterator mi; mi; ++mi)
     {
-        if (mons == *mi)
+        // Check the summoner first: it's a plain field compare, where
+        // is_summoned() searches the enchantment list, and most monsters
+        // on the level are somebody else's.
+        if (mons == *mi || caster->mid != mi->summoner)
             continue;
 
         int duration = 0;
         int stype    = 0;
         const bool summoned = mi->is_summoned(&duration, &stype);
-        if (summoned && stype == spell && caster->mid == mi->summoner
-            && mons_aligned(caster, *mi))
+        if (summoned && stype == spell && mons_aligned(caster, *mi))
         {
             // Count large abominations and tentacled monstrosities separately
             if (spell == SPELL_SUMMON_HORRIBLE_THINGS && mi->type != mons->type)
@@ -3630,16 +3632,15 @@ int count_summons(const actor *summoner, spell_type spell)
     int count = 0;
     for (monster_iterator mi; mi; ++mi)
     {
-        if (summoner == *mi)
+        // As in summoned_monster(), check the cheap summoner field before
+        // searching the enchantment list.
+        if (summoner == *mi || summoner->mid != mi->summoner)
             continue;
 
         int stype    = 0;
         const bool summoned = mi->is_summoned(nullptr, &stype);
-        if (summoned && stype == spell && summoner->mid == mi->summoner
-            && mons_aligned(summoner, *mi))
-        {
+        if (summoned && stype == spell && mons_aligned(summoner, *mi))
             count++;
-        }
     }
 
     return count;
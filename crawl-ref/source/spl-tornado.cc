@@ -168,7 +168,9 @@ static bool _mons_is_unmovable(const monster *mons)
 }
 
 static coord_def _rotate(coord_def org, coord_def from,
-                         vector<coord_def> &avail, int rdur)
+                         const vector<coord_def> &avail,
+                         const vector<pair<double, double> > &avail_polar,
+                         int rdur)
 {
     if (avail.empty())
         return from;
@@ -180,16 +182,15 @@ static coord_def _rotate(coord_def org, coord_def from,
     double ang0 = atan2(from.x - org.x, from.y - org.y) + rdur * 0.01;
     if (ang0 > PI)
         ang0 -= 2 * PI;
-    for (coord_def pos : avail)
+    for (unsigned int i = 0; i < avail.size(); i++)
     {
-        double dist = sqrt((pos - org).abs());
-        double distdiff = fabs(dist - dist0);
-        double ang = atan2(pos.x - org.x, pos.y - org.y);
+        double distdiff = fabs(avail_polar[i].first - dist0);
+        double ang = avail_polar[i].second;
         double angdiff = min(fabs(ang - ang0), fabs(ang - ang0 + 2 * PI));
 
         double score = distdiff + angdiff * 2;
         if (score < hiscore)
-            best = pos, hiscore = score;
+            best = avail[i], hiscore = score;
     }
 
     // must find _something_, the original space might be already taken
@@ -413,17 +414,28 @@ void tornado_damage(actor *caster, int dur)
         if (actor_at(move_avail[i]))
             erase_any(move_avail, i);
 
+    // The polar coordinates of the destinations are the same for every
+    // tossed actor, so work them out once rather than per actor.
+    vector<pair<double, double> > move_polar;
+    move_polar.reserve(move_avail.size());
+    for (const coord_def &pos : move_avail)
+    {
+        move_polar.emplace_back(sqrt((pos - org).abs()),
+                                atan2(pos.x - org.x, pos.y - org.y));
+    }
+
     // Calculate destinations.
     for (actor *act : move_act)
     {
         coord_def pos = move_dest[act->mid];
         int r = pos.range(org);
-        coord_def dest = _rotate(org, pos, move_avail, rdurs[r]);
+        coord_def dest = _rotate(org, pos, move_avail, move_polar, rdurs[r]);
         for (unsigned int j = 0; j < move_avail.size(); j++)
             if (move_avail[j] == dest)
             {
                 // Only one monster per destination.
                 erase_any(move_avail, j);
+                erase_any(move_polar, j);
                 break;
             }
         move_dest[act->mid] = dest;
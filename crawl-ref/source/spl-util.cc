@@ -140,8 +140,12 @@ spell_type spell_by_name(string name, bool partial_match)
 
     lowercase(name);
 
-    if (!partial_match)
-        return lookup(spell_name_cache, name, SPELL_NO_SPELL);
+    // A name matching a title in full is the right answer whether or not
+    // partial matches are allowed, and the cache settles it without
+    // scanning the spell table.
+    const spell_type exact = lookup(spell_name_cache, name, SPELL_NO_SPELL);
+    if (exact != SPELL_NO_SPELL || !partial_match)
+        return exact;
 
     const spell_type sp = find_earliest_match(name, SPELL_NO_SPELL, NUM_SPELLS,
                                               is_valid_spell, spell_title);
@@ -1041,8 +1041,8 @@ void down_stairs(dungeon_feature_type force_stair, bool force_known_shaft,
 
 static bool _any_glowing_mold()
 {
-    for (rectangle_iterator ri(0); ri; ++ri)
-        if (glowing_mold(*ri))
+    for (const terrain_property_t prop : env.pgrid)
+        if (prop & FPROP_GLOW_MOLD)
             return true;
     for (monster_iterator mon_it; mon_it; ++mon_it)
         if (mon_it->type == MONS_HYPERACTIVE_BALLISTOMYCETE)
@@ -1064,9 +1064,12 @@ static void _update_level_state()
     for (monster_iterator mon_it; mon_it; ++mon_it)
         if (mons_allows_beogh(*mon_it))
             env.level_state |= LSTATE_BEOGH;
-    for (rectangle_iterator ri(0); ri; ++ri)
-        if (grd(*ri) == DNGN_SLIMY_WALL)
+    for (const dungeon_feature_type feat : grd)
+        if (feat == DNGN_SLIMY_WALL)
+        {
             env.level_state |= LSTATE_SLIMY_WALL;
+            break;
+        }
 
     env.orb_pos = orb_position();
     if (player_has_orb())
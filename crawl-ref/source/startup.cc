@@ -14,6 +14,7 @@
 #include "coordit.h"
 #include "ctest.h"
 #include "database.h"
+#include "dbg-bench.h"
 #include "dbg-maps.h"
 #include "dbg-objstat.h"
 #include "dungeon.h"
@@ -179,6 +180,13 @@ static void _initialize()
         clrscr();
     }
 
+    if (crawl_state.bench)
+    {
+        dgn_reset_level();
+        run_benchmarks();
+        // doesn't return
+    }
+
     if (crawl_state.test)
     {
 #if defined(DEBUG_TESTS) && !defined(DEBUG)
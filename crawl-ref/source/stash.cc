@@ -23,6 +23,7 @@
 #include "env.h"
 #include "feature.h"
 #include "godpassive.h"
+#include "hash.h"
 #include "hints.h"
 #include "invent.h"
 #include "itemprop.h"
@@ -159,7 +160,8 @@ static void _fully_identify_item(item_def *item)
 // Stash
 // ----------------------------------------------------------------------
 
-Stash::Stash(int xp, int yp) : enabled(true), items()
+Stash::Stash(int xp, int yp) : enabled(true), items(),
+    search_names(), search_texts(), search_key(0)
 {
     // First, fix what square we're interested in
     if (xp == -1)
@@ -590,6 +592,54 @@ string Stash::feature_description() const
     return feat_desc;
 }
 
+// Counter bumped whenever an item type gets identified; item names
+// rendered before that may be stale.
+static uint64_t _stash_type_id_gen = 1;
+
+void stash_item_type_identified()
+{
+    _stash_type_id_gen++;
+}
+
+// Hash of the state that determines how this stash's items print, used to
+// invalidate the cached search text.
+uint64_t Stash::_search_text_key() const
+{
+    uint64_t key = hash3(_stash_type_id_gen, items.size(), feat);
+    for (const item_def &item : items)
+    {
+        const int32_t props[] =
+        {
+            item.base_type, item.sub_type, item.plus, item.plus2,
+            static_cast<int32_t>(item.special), item.quantity,
+            static_cast<int32_t>(item.flags),
+        };
+        key = hash3(key, hash32(props, sizeof(props)),
+                    hash32(item.inscription.c_str(),
+                           item.inscription.length()));
+    }
+    return key;
+}
+
+void Stash::_maybe_rebuild_search_text() const
+{
+    const uint64_t key = _search_text_key();
+    if (key == search_key)
+        return;
+
+    search_names.clear();
+    search_texts.clear();
+    for (const item_def &item : items)
+    {
+        const string s   = stash_item_name(item);
+        const string ann = stash_annotate_item(STASH_LUA_SEARCH_ANNOTATE,
+                                               &item);
+        search_names.push_back(s);
+        search_texts.push_back(ann + s);
+    }
+    search_key = key;
+}
+
 bool Stash::matches_search(const string &prefix,
                            const base_pattern &search,
                            stash_search_result &res) const
@@ -597,11 +647,13 @@ bool Stash::matches_search(const string &prefix,
     if (!enabled || items.empty() && feat == DNGN_FLOOR)
         return false;
 
-    for (const item_def &item : items)
+    _maybe_rebuild_search_text();
+
+    for (unsigned int i = 0; i < items.size(); i++)
     {
-        const string s   = stash_item_name(item);
-        const string ann = stash_annotate_item(STASH_LUA_SEARCH_ANNOTATE, &item);
-        if (search.matches(prefix + " " + ann + s))
+        const item_def &item = items[i];
+        const string &s      = search_names[i];
+        if (search.matches(prefix + " " + search_texts[i]))
         {
             if (!res.count++)
                 res.match = s;
@@ -1120,7 +1172,10 @@ void ShopInfo::load(reader& inf)
 LevelStashes::LevelStashes()
     : m_place(level_id::current()),
       m_stashes(),
-      m_shops()
+      m_shops(),
+      m_search_index(),
+      m_search_fallback(),
+      m_search_index_dirty(true)
 {
 }
 
@@ -1210,13 +1265,17 @@ bool LevelStashes::update_stash(const coord_def& c)
     s->update();
     if (s->empty())
         kill_stash(*s);
+    m_search_index_dirty = true;
     return true;
 }
 
 bool LevelStashes::unmark_trapping_nets(const coord_def &c)
 {
     if (Stash *s = find_stash(c))
+    {
+        m_search_index_dirty = true;
         return s->unmark_trapping_nets();
+    }
     else
         return false;
 }
@@ -1234,12 +1293,14 @@ void LevelStashes::move_stash(const coord_def& from, const coord_def& to)
     s->y = to.y;
     m_stashes.insert(make_pair(s->abs_pos(), *s));
     m_stashes.erase(old_abs);
+    m_search_index_dirty = true;
 }
 
 // Removes a Stash from the level.
 void LevelStashes::kill_stash(const Stash &s)
 {
     m_stashes.erase(s.abs_pos());
+    m_search_index_dirty = true;
 }
 
 void LevelStashes::no_stash(int x, int y)
@@ -1260,6 +1321,7 @@ void LevelStashes::no_stash(int x, int y)
 
         m_stashes[ newStash.abs_pos() ] = newStash;
     }
+    m_search_index_dirty = true;
 
     mpr(en? "I'll no longer ignore what I see on this square."
           : "Ok, I'll ignore what I see on this square.");
@@ -1280,6 +1342,7 @@ void LevelStashes::add_stash(int x, int y)
         if (!new_stash.empty())
             m_stashes[ new_stash.abs_pos() ] = new_stash;
     }
+    m_search_index_dirty = true;
 }
 
 bool LevelStashes::is_current() const
@@ -1326,6 +1389,101 @@ void LevelStashes::_waypoint_search(
     results.push_back(res);
 }
 
+// Lowercase text and add each whitespace-delimited word to tokens.
+static void _add_search_tokens(const string &text, set<string> &tokens)
+{
+    for (const string &word : split_string(" ", lowercase_string(text)))
+        tokens.insert(word);
+}
+
+// A search can be resolved against the word index only if it's a plain
+// case-insensitive substring search; anything that looks like a regex (or
+// a lua pattern) has to fall back to matching every stash.
+static bool _is_simple_search(const string &s)
+{
+    return !s.empty()
+           && s.find_first_of("\\^$.[]()*+?|{}<>=:") == string::npos;
+}
+
+void LevelStashes::_rebuild_search_index() const
+{
+    m_search_index.clear();
+    m_search_fallback.clear();
+
+    const string lplace = "{" + m_place.describe() + "}";
+    for (const auto &entry : m_stashes)
+    {
+        const Stash &s = entry.second;
+        if (!s.enabled)
+            continue;
+
+        set<string> tokens;
+        s._maybe_rebuild_search_text();
+        for (unsigned int i = 0; i < s.items.size(); i++)
+        {
+            // Index exactly the text matches_search() will match against.
+            _add_search_tokens(lplace + " " + s.search_texts[i], tokens);
+
+            // Artefact descriptions are searched too; don't try to index
+            // them, just always treat the stash as a candidate.
+            if (is_dumpable_artefact(s.items[i]))
+                m_search_fallback.insert(entry.first);
+        }
+        if (s.feat != DNGN_FLOOR)
+            _add_search_tokens(s.feature_description(), tokens);
+
+        for (const string &token : tokens)
+            m_search_index[token].insert(entry.first);
+    }
+
+    m_search_index_dirty = false;
+}
+
+// Find the set of stashes that could possibly match the search, using the
+// inverted index. Returns false if the search can't use the index, in
+// which case every stash must be matched the slow way.
+bool LevelStashes::_get_search_candidates(const base_pattern &search,
+                                          set<int> &candidates) const
+{
+    const string &spec = search.tostring();
+    if (!_is_simple_search(spec))
+        return false;
+
+    if (m_search_index_dirty)
+        _rebuild_search_index();
+
+    // Every word of the search must occur (as a substring of a word) in a
+    // matching stash's text, so intersecting per-word candidate sets gives
+    // a superset of the true matches.
+    bool first = true;
+    for (const string &word : split_string(" ", lowercase_string(spec)))
+    {
+        set<int> word_hits;
+        for (const auto &entry : m_search_index)
+            if (entry.first.find(word) != string::npos)
+                word_hits.insert(entry.second.begin(), entry.second.end());
+
+        if (first)
+        {
+            candidates = word_hits;
+            first = false;
+        }
+        else
+        {
+            set<int> both;
+            set_intersection(candidates.begin(), candidates.end(),
+                             word_hits.begin(), word_hits.end(),
+                             inserter(both, both.begin()));
+            candidates = both;
+        }
+    }
+    if (first)
+        return false;
+
+    candidates.insert(m_search_fallback.begin(), m_search_fallback.end());
+    return true;
+}
+
 void LevelStashes::get_matching_stashes(
         const base_pattern &search,
         vector<stash_search_result> &results) const
@@ -1346,8 +1504,13 @@ void LevelStashes::get_matching_stashes(
         return;
     }
 
+    set<int> candidates;
+    const bool indexed = _get_search_candidates(search, candidates);
+
     for (const auto &entry : m_stashes)
     {
+        if (indexed && !candidates.count(entry.first))
+            continue;
         if (entry.second.enabled)
         {
             stash_search_result res;
@@ -1374,12 +1537,14 @@ void LevelStashes::_update_corpses(int rot_time)
 {
     for (auto &entry : m_stashes)
         entry.second._update_corpses(rot_time);
+    m_search_index_dirty = true;
 }
 
 void LevelStashes::_update_identification()
 {
     for (auto &entry : m_stashes)
         entry.second._update_identification();
+    m_search_index_dirty = true;
 }
 
 void LevelStashes::write(FILE *f, bool identify) const
@@ -1435,6 +1600,8 @@ void LevelStashes::load(reader& inf)
             m_stashes[ s.abs_pos() ] = s;
     }
 
+    m_search_index_dirty = true;
+
     m_shops.clear();
     int shopc = unmarshallShort(inf);
     for (int i = 0; i < shopc; ++i)
@@ -7,6 +7,7 @@
 #define STASH_H
 
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -82,6 +83,8 @@ private:
     void _update_corpses(int rot_time);
     void _update_identification();
     void add_item(const item_def &item, bool add_to_front = false);
+    uint64_t _search_text_key() const;
+    void _maybe_rebuild_search_text() const;
 
 private:
     bool verified;      // Is this correct to the best of our knowledge?
@@ -93,6 +96,15 @@ private:
 
     vector<item_def> items;
 
+    // Cached rendered search text per item (annotation + item name, and
+    // the bare name for result display), so repeated searches over an
+    // unchanged stash do no item-name formatting. Invalidated by a hash
+    // of the items' identity/quantity state and the global type-id
+    // generation.
+    mutable vector<string> search_names;
+    mutable vector<string> search_texts;
+    mutable uint64_t search_key;
+
     static bool are_items_same(const item_def &, const item_def &,
                                bool exact = false);
 
@@ -284,6 +296,9 @@ public:
     void _update_corpses(int rot_time);
     void _update_identification();
     void _waypoint_search(int n, vector<stash_search_result> &results) const;
+    void _rebuild_search_index() const;
+    bool _get_search_candidates(const base_pattern &search,
+                                set<int> &candidates) const;
 
  private:
     typedef map<int, Stash>  stashes_t;
@@ -294,6 +309,16 @@ public:
     stashes_t m_stashes;
     shops_t m_shops;
 
+    // Inverted index (lowercased word -> stash abspos) used to narrow
+    // searches down to a candidate set of stashes, so Ctrl-F doesn't have
+    // to regenerate and regex-match item names for every stash on the
+    // level. Rebuilt lazily after any stash on the level changes.
+    mutable map<string, set<int>> m_search_index;
+    // Stashes that always need full matching (e.g. artefacts, whose
+    // descriptions are searched too).
+    mutable set<int> m_search_fallback;
+    mutable bool m_search_index_dirty;
+
     friend class StashTracker;
     friend class ST_ItemIterator;
 };
@@ -402,6 +427,10 @@ private:
 
 extern StashTracker StashTrack;
 
+// Item names can change when an item type is identified; this invalidates
+// all cached stash search text.
+void stash_item_type_identified();
+
 void maybe_update_stashes();
 bool is_stash(const coord_def& c);
 string get_stash_desc(const coord_def& c);
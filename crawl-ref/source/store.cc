@@ -1240,7 +1240,9 @@ CrawlHashTable::CrawlHashTable()
 
 CrawlHashTable::CrawlHashTable(const CrawlHashTable& other)
 {
-    if (other.hash_map == nullptr)
+    // An allocated but empty map copies as an unallocated one; item_def
+    // copies during pile management hit this constantly.
+    if (other.hash_map == nullptr || other.hash_map->empty())
     {
         hash_map = nullptr;
         return;
@@ -1262,16 +1264,22 @@ CrawlHashTable::~CrawlHashTable()
 
 CrawlHashTable &CrawlHashTable::operator = (const CrawlHashTable &other)
 {
-    if (hash_map != nullptr)
-        delete hash_map;
+    if (this == &other)
+        return *this;
 
-    if (other.hash_map == nullptr)
+    if (other.hash_map == nullptr || other.hash_map->empty())
     {
+        delete hash_map;
         hash_map = nullptr;
         return *this;
     }
 
-    hash_map = new hash_map_type(*(other.hash_map));
+    // Assign into an existing map rather than tearing it down just to
+    // allocate a fresh one.
+    if (hash_map != nullptr)
+        *hash_map = *(other.hash_map);
+    else
+        hash_map = new hash_map_type(*(other.hash_map));
 
     return *this;
 }
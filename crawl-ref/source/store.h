@@ -275,6 +275,11 @@ public:
     void read(reader &);
 
     bool exists(const string &key) const;
+    // Hot paths probe props with literals every turn; skip building the
+    // string temporary when the table was never populated, which is the
+    // common case.
+    bool exists(const char *key) const
+    { return !empty() && exists(string(key)); }
     void assert_validity() const;
 
     // NOTE: If the const versions of get_value() or [] are given a
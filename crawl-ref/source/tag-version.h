@@ -153,6 +153,8 @@ enum tag_minor_version
     TAG_MINOR_MAX_XL,              // Store max XL instead of hardcoding it
     TAG_MINOR_NO_RPOIS_MINUS,      // Remove rPois- artefacts
     TAG_MINOR_XP_PENANCE,          // Let gods other than Ash use xp penance
+    TAG_MINOR_RLE_GRIDS,           // Run-length encode terrain and fprop grids
+    TAG_MINOR_STRING_INTERN,       // Intern repeated marshalled strings
 #endif
     NUM_TAG_MINORS,
     TAG_MINOR_VERSION = NUM_TAG_MINORS - 1
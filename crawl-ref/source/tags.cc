@@ -202,12 +202,6 @@ void reader::read(void *data, size_t size)
     }
 }
 
-int reader::getMinorVersion() const
-{
-    ASSERT(_minorVersion != TAG_MINOR_INVALID);
-    return _minorVersion;
-}
-
 void reader::setMinorVersion(int minorVersion)
 {
     _minorVersion = minorVersion;
@@ -269,6 +263,43 @@ long writer::tell()
     return _file? ftell(_file) : _pbuf->size();
 }
 
+// Interning table for marshallString: the first SHRT_MAX distinct strings
+// a writer emits get the ids 1, 2, ...  Returns the id of an already
+// interned string, or 0 after assigning a fresh id, in which case the
+// caller must write the string in full.  The matching reader rebuilds the
+// same table from the full strings it reads, so references line up as
+// long as the stream is read back in write order.
+int writer::intern(const string &s)
+{
+    if (!_interning)
+        return 0;
+
+    if ((int)_interned.size() >= SHRT_MAX)
+    {
+        auto it = _interned.find(s);
+        return it == _interned.end() ? 0 : it->second;
+    }
+
+    int &id = _interned[s];
+    if (id)
+        return id;
+    id = _interned.size();
+    return 0;
+}
+
+void reader::intern(const string &s)
+{
+    // Mirrors the id cap in writer::intern().
+    if ((int)_interned.size() < SHRT_MAX)
+        _interned.push_back(s);
+}
+
+const string &reader::interned(int id) const
+{
+    ASSERT_RANGE(id, 1, (int)_interned.size() + 1);
+    return _interned[id - 1];
+}
+
 #ifdef DEBUG_GLOBALS
 // Force a conditional jump valgrind may pick up, no matter the optimizations.
 static volatile uint32_t hashroll;
@@ -749,7 +780,7 @@ static void _run_length_encode(writer &th, marshall m, const grid &g,
         {
             if (!nlast)
                 last = g[x][y];
-            if (last == g[x][y] && nlast < 255)
+            if (last == (int)g[x][y] && nlast < 255)
             {
                 nlast++;
                 continue;
@@ -775,7 +806,7 @@ static void _run_length_decode(reader &th, unmarshall um, grid &g,
     while (offset < end)
     {
         const int run = unmarshallUByte(th);
-        const int value = um(th);
+        const auto value = um(th);
 
         for (int i = 0; i < run; ++i)
         {
@@ -813,7 +844,7 @@ float unmarshallFloat(reader &th)
 }
 
 // string -- 2 byte length, string data
-void marshallString(writer &th, const string &data)
+static void _marshallStringRaw(writer &th, const string &data)
 {
     size_t len = data.length();
     // A limit of 32K.
@@ -824,11 +855,10 @@ void marshallString(writer &th, const string &data)
     th.write(data.c_str(), len);
 }
 
-string unmarshallString(reader &th)
+static string _unmarshallStringRaw(reader &th, short len)
 {
     char buffer[SHRT_MAX];
 
-    short len = unmarshallShort(th);
     ASSERT(len >= 0);
     ASSERT(len <= (ssize_t)sizeof(buffer));
 
@@ -837,16 +867,46 @@ string unmarshallString(reader &th)
     return string(buffer, len);
 }
 
+void marshallString(writer &th, const string &data)
+{
+    // Prop table keys, artefact names and the like repeat endlessly, so
+    // strings are interned per writer: a repeat is written as a reference
+    // to its first occurrence, marked by a negative length.
+    if (int id = th.intern(data))
+    {
+        marshallShort(th, -id);
+        return;
+    }
+    _marshallStringRaw(th, data);
+}
+
+string unmarshallString(reader &th)
+{
+    short len = unmarshallShort(th);
+    if (len < 0)
+    {
+#if TAG_MAJOR_VERSION == 34
+        ASSERT(th.getMinorVersion() >= TAG_MINOR_STRING_INTERN);
+#endif
+        return th.interned(-len);
+    }
+
+    const string s = _unmarshallStringRaw(th, len);
+    th.intern(s);
+    return s;
+}
+
 // This one must stay with a 16 bit signed big-endian length tag, to allow
-// older versions to browse and list newer saves.
+// older versions to browse and list newer saves; that also rules out the
+// interning done by marshallString, which writes negative lengths.
 static void marshallString2(writer &th, const string &data)
 {
-    marshallString(th, data);
+    _marshallStringRaw(th, data);
 }
 
 static string unmarshallString2(reader &th)
 {
-    return unmarshallString(th);
+    return _unmarshallStringRaw(th, unmarshallShort(th));
 }
 
 // string -- 4 byte length, non-terminated string data.
@@ -1110,7 +1170,14 @@ static void _add_missing_branches()
 // tagId specifies what to write.
 void tag_write(tag_type tagID, writer &outf)
 {
+    // Level chunks marshal to hundreds of kilobytes; rather than grow
+    // the buffer from nothing through a dozen reallocations on every
+    // stair transition, start it at the size the last chunk of this
+    // type needed.
+    static size_t last_size[NUM_TAGS] = {};
+
     vector<unsigned char> buf;
+    buf.reserve(last_size[tagID]);
     writer th(&buf);
     switch (tagID)
     {
@@ -1151,6 +1218,8 @@ void tag_write(tag_type tagID, writer &outf)
     if (buf.empty())
         return;
 
+    last_size[tagID] = buf.size();
+
     // Write tag header.
     marshallInt(outf, buf.size());
 
@@ -3616,13 +3685,16 @@ static void tag_construct_level(writer &th)
 
     CANARY;
 
+    // The terrain and terrain-property grids are written as separate
+    // run-length encoded planes: both are dominated by long runs of
+    // identical values (rock, floor, zero properties), so this is far
+    // smaller and faster than marshalling every cell. Map knowledge
+    // stays per-cell, as each cell carries its own flags and overlays.
+    _run_length_encode(th, marshallByte, grd, GXM, GYM);
     for (int count_x = 0; count_x < GXM; count_x++)
         for (int count_y = 0; count_y < GYM; count_y++)
-        {
-            marshallByte(th, grd[count_x][count_y]);
             marshallMapCell(th, env.map_knowledge[count_x][count_y]);
-            marshallInt(th, env.pgrid[count_x][count_y]);
-        }
+    _run_length_encode(th, marshallInt, env.pgrid, GXM, GYM);
 
     marshallBoolean(th, !!env.map_forgotten.get());
     if (env.map_forgotten.get())
@@ -4939,30 +5011,54 @@ static void tag_read_level(reader &th)
     EAT_CANARY;
 
     env.map_seen.reset();
-    for (int i = 0; i < gx; i++)
-        for (int j = 0; j < gy; j++)
-        {
-            dungeon_feature_type feat = unmarshallFeatureType(th);
-            grd[i][j] = feat;
-            ASSERT(feat < NUM_FEATURES);
-#if TAG_MAJOR_VERSION == 34
-            if (feat == DNGN_SEALED_DOOR && th.getMinorVersion() < TAG_MINOR_0_12)
-                grd[i][j] = DNGN_CLOSED_DOOR;
-            if (feat == DNGN_BADLY_SEALED_DOOR)
-                grd[i][j] = DNGN_SEALED_DOOR;
-            if (feat == DNGN_ESCAPE_HATCH_UP
-                && player_in_branch(BRANCH_LABYRINTH))
+#if TAG_MAJOR_VERSION == 34
+    if (th.getMinorVersion() < TAG_MINOR_RLE_GRIDS)
+    {
+        // Old interleaved per-cell format.
+        for (int i = 0; i < gx; i++)
+            for (int j = 0; j < gy; j++)
             {
-                grd[i][j] = DNGN_EXIT_LABYRINTH;
+                dungeon_feature_type feat = unmarshallFeatureType(th);
+                grd[i][j] = feat;
+                ASSERT(feat < NUM_FEATURES);
+                if (feat == DNGN_SEALED_DOOR
+                    && th.getMinorVersion() < TAG_MINOR_0_12)
+                {
+                    grd[i][j] = DNGN_CLOSED_DOOR;
+                }
+                if (feat == DNGN_BADLY_SEALED_DOOR)
+                    grd[i][j] = DNGN_SEALED_DOOR;
+                if (feat == DNGN_ESCAPE_HATCH_UP
+                    && player_in_branch(BRANCH_LABYRINTH))
+                {
+                    grd[i][j] = DNGN_EXIT_LABYRINTH;
+                }
+                if (feat == DNGN_DEEP_WATER && player_in_branch(BRANCH_SHOALS)
+                    && th.getMinorVersion() < TAG_MINOR_SHOALS_LITE)
+                {
+                    grd[i][j] = DNGN_SHALLOW_WATER;
+                }
+
+                unmarshallMapCell(th, env.map_knowledge[i][j]);
+                env.pgrid[i][j] = unmarshallInt(th);
             }
-            if (feat == DNGN_DEEP_WATER && player_in_branch(BRANCH_SHOALS)
-                && th.getMinorVersion() < TAG_MINOR_SHOALS_LITE)
+    }
+    else
+#endif
+    {
+        _run_length_decode(th, unmarshallFeatureType, grd, GXM, GYM);
+        for (int i = 0; i < gx; i++)
+            for (int j = 0; j < gy; j++)
             {
-                grd[i][j] = DNGN_SHALLOW_WATER;
+                ASSERT(grd[i][j] < NUM_FEATURES);
+                unmarshallMapCell(th, env.map_knowledge[i][j]);
             }
-#endif
+        _run_length_decode(th, unmarshallInt, env.pgrid, GXM, GYM);
+    }
 
-            unmarshallMapCell(th, env.map_knowledge[i][j]);
+    for (int i = 0; i < gx; i++)
+        for (int j = 0; j < gy; j++)
+        {
             // Fixup positions
             if (env.map_knowledge[i][j].monsterinfo())
                 env.map_knowledge[i][j].monsterinfo()->pos = coord_def(i, j);
@@ -4972,7 +5068,6 @@ static void tag_read_level(reader &th)
             env.map_knowledge[i][j].flags &= ~MAP_VISIBLE_FLAG;
             if (env.map_knowledge[i][j].seen())
                 env.map_seen.set(i, j);
-            env.pgrid[i][j] = unmarshallInt(th);
 
             mgrd[i][j] = NON_MONSTER;
             env.cgrid[i][j] = EMPTY_CLOUD;
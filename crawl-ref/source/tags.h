@@ -37,19 +37,21 @@ class writer
 public:
     writer(const string &filename, FILE* output, bool ignore_errors = false)
         : _filename(filename), _file(output), _chunk(0),
-          _ignore_errors(ignore_errors), _pbuf(0), failed(false)
+          _ignore_errors(ignore_errors), _pbuf(0), _interning(true),
+          failed(false)
     {
         ASSERT(output);
     }
     writer(vector<unsigned char>* poutput)
         : _filename(), _file(0), _chunk(0), _ignore_errors(false),
-          _pbuf(poutput), failed(false) { ASSERT(poutput); }
-    writer(package *save, const string &chunkname)
+          _pbuf(poutput), _interning(true), failed(false) { ASSERT(poutput); }
+    writer(package *save, const string &chunkname,
+           int compression = Z_DEFAULT_COMPRESSION)
         : _filename(), _file(0), _chunk(0), _ignore_errors(false),
-          failed(false)
+          _pbuf(0), _interning(true), failed(false)
     {
         ASSERT(save);
-        _chunk = save->writer(chunkname);
+        _chunk = save->writer(chunkname, compression);
     }
 
     ~writer() { if (_chunk) delete _chunk; }
@@ -60,6 +62,12 @@ public:
 
     bool succeeded() const { return !failed; }
 
+    // Strings written with marshallString are interned per writer; see
+    // tags.cc.  Must be off for output that gets read from the middle,
+    // like the des cache's .dsc files.
+    void set_interning(bool setting) { _interning = setting; }
+    int intern(const string &s);
+
 private:
     void check_ok(bool ok);
 
@@ -71,6 +79,9 @@ private:
 
     vector<unsigned char>* _pbuf;
 
+    bool _interning;
+    map<string, int> _interned;
+
     bool failed;
 };
 
@@ -111,7 +122,13 @@ public:
     unsigned char readByte();
     void read(void *data, size_t size);
     void advance(size_t size);
-    int getMinorVersion() const;
+    // Consulted for nearly every field read from a save, so keep it
+    // inline: the load path is one long chain of version checks.
+    int getMinorVersion() const
+    {
+        ASSERT(_minorVersion != TAG_MINOR_INVALID);
+        return _minorVersion;
+    }
     void setMinorVersion(int minorVersion);
     bool valid() const;
     void fail_if_not_eof(const string &name);
@@ -121,6 +138,10 @@ public:
 
     void set_safe_read(bool setting) { _safe_read = setting; }
 
+    // Mirror of writer's string interning table; see tags.cc.
+    void intern(const string &s);
+    const string &interned(int id) const;
+
 private:
     string _filename;
     FILE* _file;
@@ -131,6 +152,7 @@ private:
     int _minorVersion;
     // always throw an exception rather than dying when reading past EOF
     bool _safe_read;
+    vector<string> _interned;
 };
 
 class short_read_exception : exception {};
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <sstream>
 
+#include "abyss.h"
 #include "areas.h"
 #include "branch.h"
 #include "cloud.h"
@@ -31,6 +32,7 @@
 #include "mapmark.h"
 #include "message.h"
 #include "misc.h"
+#include "mon-pathfind.h"
 #include "mon-place.h"
 #include "mon-util.h"
 #include "ouch.h"
@@ -70,7 +72,7 @@ bool feat_is_malign_gateway_suitable(dungeon_feature_type feat)
  */
 bool feat_is_wall(dungeon_feature_type feat)
 {
-    return get_feature_def(feat).flags & FFT_WALL;
+    return feat_flags_table[feat] & FFT_WALL;
 }
 
 /** Is this feature one of the main stone downstairs of a level?
@@ -332,14 +334,14 @@ command_type feat_stair_direction(dungeon_feature_type feat)
  */
 bool feat_is_opaque(dungeon_feature_type feat)
 {
-    return get_feature_def(feat).flags & FFT_OPAQUE;
+    return feat_flags_table[feat] & FFT_OPAQUE;
 }
 
 /** Can you move into this feature in normal play?
  */
 bool feat_is_solid(dungeon_feature_type feat)
 {
-    return get_feature_def(feat).flags & FFT_SOLID;
+    return feat_flags_table[feat] & FFT_SOLID;
 }
 
 /** Can you move into this cell in normal play?
@@ -631,7 +633,7 @@ int count_neighbours_with_func(const coord_def& c, bool (*checker)(dungeon_featu
 // For internal use by find_connected_identical only.
 static void _find_connected_identical(const coord_def &d,
                                       dungeon_feature_type ft,
-                                      set<coord_def>& out)
+                                      coord_set& out)
 {
     if (grd(d) != ft)
         return;
@@ -645,7 +647,7 @@ static void _find_connected_identical(const coord_def &d,
         return;
     }
 
-    if (out.insert(d).second)
+    if (out.insert(d))
     {
         _find_connected_identical(coord_def(d.x+1, d.y), ft, out);
         _find_connected_identical(coord_def(d.x-1, d.y), ft, out);
@@ -655,7 +657,7 @@ static void _find_connected_identical(const coord_def &d,
 }
 
 // Find all connected cells containing ft, starting at d.
-void find_connected_identical(const coord_def &d, set<coord_def>& out)
+void find_connected_identical(const coord_def &d, coord_set& out)
 {
     string prop = env.markers.property_at(d, MAT_ANY, "connected_exclude");
 
@@ -1725,7 +1727,12 @@ void destroy_wall(const coord_def& p)
 
     _revert_terrain_to(p, (player_in_branch(BRANCH_SWAMP) ? DNGN_SHALLOW_WATER
                                                           : DNGN_FLOOR));
-    env.level_map_mask(p) |= MMT_TURNED_TO_FLOOR;
+    if (!(env.level_map_mask(p) & MMT_TURNED_TO_FLOOR))
+    {
+        env.level_map_mask(p) |= MMT_TURNED_TO_FLOOR;
+        if (player_in_branch(BRANCH_ABYSS))
+            abyss_note_turned_to_floor();
+    }
 }
 
 /**
@@ -1859,6 +1866,9 @@ void set_terrain_changed(const coord_def p)
     }
 
     env.map_knowledge(p).flags |= MAP_CHANGED_FLAG;
+    view_mark_dirty(p);
+    mons_path_invalidate_flood();
+    travel_distance_map_invalidate();
 
     dungeon_events.fire_position_event(DET_FEAT_CHANGE, p);
 
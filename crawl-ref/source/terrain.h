@@ -8,6 +8,7 @@
 
 #include <memory>
 
+#include "coord-set.h"
 #include "enum.h"
 
 class  actor;
@@ -85,7 +86,7 @@ bool feat_is_mimicable(dungeon_feature_type feat, bool strict = true);
 
 int count_neighbours_with_func(const coord_def& c, bool (*checker)(dungeon_feature_type));
 
-void find_connected_identical(const coord_def& d, set<coord_def>& out);
+void find_connected_identical(const coord_def& d, coord_set& out);
 coord_def get_random_stair();
 
 bool slime_wall_neighbour(const coord_def& c);
@@ -1,3 +1,18 @@
+/**
+ * @file
+ * @brief Thin portability wrappers over pthreads / Win32 threads.
+ *
+ * Deliberately just primitives, not a pool: all game state (you, env,
+ * menv and friends) is mutated through unlocked globals, so the only
+ * work that can safely run off the main thread is self-contained I/O
+ * with no game-state access - currently the parallel text-database
+ * builds at startup (database.cc), which spawn and join their own
+ * threads around a single call.  A shared worker pool would need a
+ * task API whose every consumer proves isolation by hand; until a
+ * second bulk workload of that shape exists, plain create/join is
+ * both simpler and harder to misuse.
+ **/
+
 #ifndef THREADS_H
 #define THREADS_H
 
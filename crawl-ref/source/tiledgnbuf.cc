@@ -20,9 +20,7 @@ DungeonCellBuffer::DungeonCellBuffer(ImageManager *im) :
     m_buf_doll(&im->m_textures[TEX_PLAYER], 17),
     m_buf_main_trans(&im->m_textures[TEX_DEFAULT], 17),
     m_buf_main(&im->m_textures[TEX_DEFAULT]),
-    m_buf_spells(&im->m_textures[TEX_GUI]),
-    m_buf_skills(&im->m_textures[TEX_GUI]),
-    m_buf_commands(&im->m_textures[TEX_GUI]),
+    m_buf_gui(&im->m_textures[TEX_GUI]),
     m_buf_icons(&im->m_textures[TEX_ICONS])
 {
 }
@@ -112,17 +110,17 @@ void DungeonCellBuffer::add_main_tile(int tileidx, int x, int y, int ox, int oy)
 
 void DungeonCellBuffer::add_spell_tile(int tileidx, int x, int y)
 {
-    m_buf_spells.add(tileidx, x, y);
+    m_buf_gui.add(tileidx, x, y);
 }
 
 void DungeonCellBuffer::add_skill_tile(int tileidx, int x, int y)
 {
-    m_buf_skills.add(tileidx, x, y);
+    m_buf_gui.add(tileidx, x, y);
 }
 
 void DungeonCellBuffer::add_command_tile(int tileidx, int x, int y)
 {
-    m_buf_commands.add(tileidx, x, y);
+    m_buf_gui.add(tileidx, x, y);
 }
 
 void DungeonCellBuffer::add_icons_tile(int tileidx, int x, int y)
@@ -145,9 +143,7 @@ void DungeonCellBuffer::clear()
     m_buf_doll.clear();
     m_buf_main_trans.clear();
     m_buf_main.clear();
-    m_buf_spells.clear();
-    m_buf_skills.clear();
-    m_buf_commands.clear();
+    m_buf_gui.clear();
     m_buf_icons.clear();
 }
 
@@ -160,9 +156,7 @@ void DungeonCellBuffer::draw()
     m_buf_doll.draw();
     m_buf_main_trans.draw();
     m_buf_main.draw();
-    m_buf_skills.draw();
-    m_buf_spells.draw();
-    m_buf_commands.draw();
+    m_buf_gui.draw();
     m_buf_icons.draw();
 }
 
@@ -53,9 +53,10 @@ protected:
     SubmergedTileBuffer m_buf_doll;
     SubmergedTileBuffer m_buf_main_trans;
     TileBuffer m_buf_main;
-    TileBuffer m_buf_spells;
-    TileBuffer m_buf_skills;
-    TileBuffer m_buf_commands;
+    // Spell, skill and command tiles all come off the GUI sheet and
+    // are never mixed in one region, so they share a buffer and draw
+    // as a single batch.
+    TileBuffer m_buf_gui;
     TileBuffer m_buf_icons;
 };
 
@@ -561,29 +561,55 @@ void pack_doll_buf(SubmergedTileBuffer& buf, const dolls_data &doll,
     // Set up mcache data based on equipment. We don't need this lookup if both
     // pairs of offsets are defined in Options.
     int draw_info_count = 0, dind = 0;
-    mcache_entry *entry = nullptr;
     tile_draw_info dinfo[mcache_entry::MAX_INFO_COUNT];
     if (Options.tile_use_monster != MONS_0)
     {
-        monster_info minfo(MONS_PLAYER, MONS_PLAYER);
-        minfo.props["monster_tile"] = short(doll.parts[TILEP_PART_BASE]);
-        item_def *item;
-        if (you.slot_item(EQ_WEAPON))
+        // The hand offsets only change when the base tile or the
+        // wielded items do, but computing them means copying the weapon
+        // and shield into a monster_info and running it through the
+        // monster cache; remember the last answer.  The cache keys its
+        // equipment handling on item tiles, so they make a safe
+        // fingerprint here.
+        const item_def *weapon = you.slot_item(EQ_WEAPON);
+        const item_def *shield = you.slot_item(EQ_SHIELD);
+        const tileidx_t weapon_tile =
+            weapon ? tileidx_item(get_item_info(*weapon)) : 0;
+        const tileidx_t shield_tile =
+            shield ? tileidx_item(get_item_info(*shield)) : 0;
+
+        static tileidx_t cached_base = 0;
+        static tileidx_t cached_weapon = 0;
+        static tileidx_t cached_shield = 0;
+        static int cached_count = -1;
+        static tile_draw_info cached_dinfo[mcache_entry::MAX_INFO_COUNT];
+
+        if (cached_count < 0
+            || cached_base != doll.parts[TILEP_PART_BASE]
+            || cached_weapon != weapon_tile
+            || cached_shield != shield_tile)
         {
-            item = new item_def(get_item_info(*you.slot_item(EQ_WEAPON)));
-            minfo.inv[MSLOT_WEAPON].reset(item);
-        }
-        if (you.slot_item(EQ_SHIELD))
-        {
-            item = new item_def(get_item_info(*you.slot_item(EQ_SHIELD)));
-            minfo.inv[MSLOT_SHIELD].reset(item);
-        }
-        tileidx_t mcache_idx = mcache.register_monster(minfo);
-        if (mcache_idx)
-        {
-            entry = mcache.get(mcache_idx);
-            draw_info_count = entry->info(&dinfo[0]);
+            monster_info minfo(MONS_PLAYER, MONS_PLAYER);
+            minfo.props["monster_tile"] =
+                short(doll.parts[TILEP_PART_BASE]);
+            if (weapon)
+                minfo.inv[MSLOT_WEAPON].reset(new item_def(get_item_info(*weapon)));
+            if (shield)
+                minfo.inv[MSLOT_SHIELD].reset(new item_def(get_item_info(*shield)));
+            cached_count = 0;
+            tileidx_t mcache_idx = mcache.register_monster(minfo);
+            if (mcache_idx)
+            {
+                mcache_entry *entry = mcache.get(mcache_idx);
+                cached_count = entry->info(&cached_dinfo[0]);
+            }
+            cached_base = doll.parts[TILEP_PART_BASE];
+            cached_weapon = weapon_tile;
+            cached_shield = shield_tile;
         }
+
+        draw_info_count = cached_count;
+        for (int i = 0; i < draw_info_count; ++i)
+            dinfo[i] = cached_dinfo[i];
     }
     // A higher index here means that the part should be drawn on top.
     // This is drawn in reverse order because this could be a ghost
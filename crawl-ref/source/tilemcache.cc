@@ -138,9 +138,41 @@ mcache_manager::~mcache_manager()
     clear_all();
 }
 
+// Whether two cache entries draw identically.  The virtual info/doll/
+// transparent calls are the entirety of what clients see of an entry,
+// so matching outputs make the entries interchangeable.
+static bool _entries_equivalent(const mcache_entry *a, const mcache_entry *b)
+{
+    if (a->transparent() != b->transparent())
+        return false;
+
+    tile_draw_info dinfo_a[mcache_entry::MAX_INFO_COUNT];
+    tile_draw_info dinfo_b[mcache_entry::MAX_INFO_COUNT];
+    const int count_a = a->info(dinfo_a);
+    const int count_b = b->info(dinfo_b);
+    if (count_a != count_b)
+        return false;
+
+    for (int i = 0; i < count_a; i++)
+    {
+        if (dinfo_a[i].idx != dinfo_b[i].idx
+            || dinfo_a[i].ofs_x != dinfo_b[i].ofs_x
+            || dinfo_a[i].ofs_y != dinfo_b[i].ofs_y)
+        {
+            return false;
+        }
+    }
+
+    const dolls_data *doll_a = a->doll();
+    const dolls_data *doll_b = b->doll();
+    if (!doll_a != !doll_b)
+        return false;
+
+    return !doll_a || *doll_a == *doll_b;
+}
+
 unsigned int mcache_manager::register_monster(const monster_info& minf)
 {
-    // TODO enne - is it worth it to search against all mcache entries?
     // TODO enne - pool mcache types to avoid too much alloc/dealloc?
 
     mcache_entry *entry;
@@ -165,6 +197,18 @@ unsigned int mcache_manager::register_monster(const monster_info& minf)
 
     tileidx_t idx = ~0;
 
+    for (unsigned int i = 0; i < m_entries.size(); i++)
+    {
+        // Share entries between identical-looking monsters: a pack of
+        // the same monster with the same equipment fills one slot
+        // rather than one per sighting.
+        if (m_entries[i] && _entries_equivalent(m_entries[i], entry))
+        {
+            delete entry;
+            return TILEP_MCACHE_START + i;
+        }
+    }
+
     for (unsigned int i = 0; i < m_entries.size(); i++)
     {
         if (!m_entries[i])
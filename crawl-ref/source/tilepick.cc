@@ -170,7 +170,7 @@ static tileidx_t _tileidx_shop(coord_def where)
     }
 }
 
-tileidx_t tileidx_feature_base(dungeon_feature_type feat)
+static tileidx_t _tileidx_feature_base(dungeon_feature_type feat)
 {
     switch (feat)
     {
@@ -475,6 +475,22 @@ tileidx_t tileidx_feature_base(dungeon_feature_type feat)
     }
 }
 
+// This runs for every out-of-los cell on every viewwindow pass, so walk
+// the switch above just once and serve lookups from a flat table.
+tileidx_t tileidx_feature_base(dungeon_feature_type feat)
+{
+    static tileidx_t feat_tiles[NUM_FEATURES];
+    static bool init = false;
+    if (!init)
+    {
+        for (int i = 0; i < NUM_FEATURES; ++i)
+            feat_tiles[i] = _tileidx_feature_base((dungeon_feature_type)i);
+        init = true;
+    }
+    ASSERT_RANGE(feat, 0, NUM_FEATURES);
+    return feat_tiles[feat];
+}
+
 bool is_door_tile(tileidx_t tile)
 {
     return tile >= TILE_DNGN_CLOSED_DOOR &&
@@ -18,6 +18,7 @@
 MapRegion::MapRegion(int pixsz) :
     m_buf(nullptr),
     m_dirty(true),
+    m_win_dirty(true),
     m_far_view(false)
 {
     ASSERT(pixsz > 0);
@@ -75,7 +76,6 @@ MapRegion::~MapRegion()
 void MapRegion::pack_buffers()
 {
     m_buf_map.clear();
-    m_buf_lines.clear();
 
     for (int x = m_min_gx; x <= m_max_gx; x++)
         for (int y = m_min_gy; y <= m_max_gy; y++)
@@ -86,8 +86,14 @@ void MapRegion::pack_buffers()
             float pos_y = y - m_min_gy;
             m_buf_map.add(pos_x, pos_y, pos_x + 1, pos_y + 1, m_colours[f]);
         }
+}
+
+// The window box moves every time the viewport does, so it gets its own
+// buffer; repacking it doesn't have to repack a quad per map cell.
+void MapRegion::pack_window()
+{
+    m_buf_lines.clear();
 
-    // Draw window box.
     if (m_win_start.x == -1 && m_win_end.x == -1)
         return;
 
@@ -113,6 +119,11 @@ void MapRegion::render()
         pack_buffers();
         m_dirty = false;
     }
+    if (m_win_dirty)
+    {
+        pack_window();
+        m_win_dirty = false;
+    }
 
     set_transform();
     m_buf_map.draw();
@@ -130,6 +141,7 @@ void MapRegion::set(const coord_def &gc, map_feature f)
 {
     ASSERT((unsigned int)f <= (unsigned char)~0);
     m_buf[gc.x + gc.y * mx] = f;
+    m_dirty = true;
 
     if (f == MF_UNSEEN)
         return;
@@ -140,6 +152,10 @@ void MapRegion::set(const coord_def &gc, map_feature f)
     m_min_gy = min(m_min_gy, gc.y);
     m_max_gy = max(m_max_gy, gc.y);
 
+    // Growing the extents shifts every quad's position, window box
+    // included.
+    m_win_dirty = true;
+
     recenter();
 }
 
@@ -169,18 +185,19 @@ void MapRegion::update_bounds()
         }
 
     recenter();
-#if 0
-    // Not needed? (jpeg)
     m_dirty = true;
-#endif
+    m_win_dirty = true;
 }
 
 void MapRegion::set_window(const coord_def &start, const coord_def &end)
 {
+    if (start == m_win_start && end == m_win_end)
+        return;
+
     m_win_start = start;
     m_win_end   = end;
 
-    m_dirty = true;
+    m_win_dirty = true;
 }
 
 void MapRegion::clear()
@@ -202,6 +219,8 @@ void MapRegion::clear()
 
     m_buf_map.clear();
     m_buf_lines.clear();
+    m_dirty = true;
+    m_win_dirty = true;
 }
 
 int MapRegion::handle_mouse(MouseEvent &event)
@@ -25,6 +25,7 @@ protected:
     virtual void on_resize();
     void recenter();
     void pack_buffers();
+    void pack_window();
 
     VColour m_colours[MF_MAX];
     int m_min_gx, m_max_gx, m_min_gy, m_max_gy;
@@ -35,6 +36,7 @@ protected:
     ShapeBuffer m_buf_map;
     LineBuffer m_buf_lines;
     bool m_dirty;
+    bool m_win_dirty;
     bool m_far_view;
 };
 
@@ -91,6 +91,7 @@ TilesFramework::TilesFramework() :
     m_viewsc(0, 0),
     m_fullscreen(false),
     m_need_redraw(false),
+    m_pending_redraw(false),
     m_active_layer(LAYER_CRT),
     m_buttons_held(0),
     m_key_mod(0),
@@ -811,6 +812,13 @@ int TilesFramework::getch_ck()
                 set_need_redraw();
                 return CK_REDRAW;
 
+            case WME_EXPOSE:
+                // The window contents were clobbered (uncovered,
+                // compositor restart, ...); repaint even though nothing
+                // in-game has changed.
+                set_need_redraw();
+                break;
+
             case WME_CUSTOMEVENT:
             default:
                 // This is only used to refresh the tooltip.
@@ -849,8 +857,15 @@ int TilesFramework::getch_ck()
                 m_tooltip.clear();
             }
 
+            // Redraw at once when something is dirty.  Repainting on a
+            // timer regardless, as this used to, kept an idle window
+            // rendering and swapping buffers for no visible change; now
+            // the timer only flushes redraw requests that were
+            // rate-limited away (see set_need_redraw), and exposure is
+            // handled as an event above.
             if (need_redraw()
-                || ticks > m_last_tick_redraw
+                || m_pending_redraw
+                   && ticks > m_last_tick_redraw
                    && ticks - m_last_tick_redraw > ticks_per_screen_redraw)
             {
                 redraw();
@@ -1429,6 +1444,7 @@ void TilesFramework::redraw()
     cprintf("\nredrawing tiles");
 #endif
     m_need_redraw = false;
+    m_pending_redraw = false;
 
     glmanager->reset_view_for_redraw(m_viewsc.x, m_viewsc.y);
 
@@ -1567,7 +1583,12 @@ void TilesFramework::set_need_redraw(unsigned int min_tick_delay)
 {
     unsigned int ticks = (wm->get_ticks() - m_last_tick_redraw);
     if (min_tick_delay && ticks <= min_tick_delay)
+    {
+        // Coalesced away, but remember it so the input loop can flush
+        // the update if no full-strength request follows.
+        m_pending_redraw = true;
         return;
+    }
 
     m_need_redraw = true;
 }
@@ -170,6 +170,9 @@ protected:
 
     bool m_fullscreen;
     bool m_need_redraw;
+    // A rate-limited redraw request was suppressed; flush it from the
+    // input loop once tile_update_rate ticks have passed.
+    bool m_pending_redraw;
 
     int TAB_ABILITY;
     int TAB_COMMAND;
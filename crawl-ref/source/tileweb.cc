@@ -6,6 +6,7 @@
 
 #include <cerrno>
 #include <cstdarg>
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -94,6 +95,7 @@ TilesFramework::TilesFramework()
       m_controlled_from_web(false),
       m_last_ui_state(UI_INIT),
       m_view_loaded(false),
+      m_send_everything_pending(false),
       m_next_view_tl(0, 0),
       m_next_view_br(-1, -1),
       m_current_flash_colour(BLACK),
@@ -115,6 +117,7 @@ TilesFramework::~TilesFramework()
 
 void TilesFramework::shutdown()
 {
+    _send_queued();
     close(m_sock);
     remove(m_sock_name.c_str());
 }
@@ -190,9 +193,22 @@ void TilesFramework::finish_message()
     if (m_msg_buf.size() == 0)
         return;
 
+    // Completed messages are queued and written out together at the
+    // next flush point (before blocking on input, once per turn, and
+    // on exit), so a turn's worth of small updates is packed into as
+    // few datagrams as possible instead of costing a write each.
     m_msg_buf.append("\n");
-    const char* fragment_start = m_msg_buf.data();
-    const char* data_end = m_msg_buf.data() + m_msg_buf.size();
+    m_queue_buf.append(m_msg_buf);
+    m_msg_buf.clear();
+}
+
+void TilesFramework::_send_queued()
+{
+    if (m_queue_buf.size() == 0)
+        return;
+
+    const char* fragment_start = m_queue_buf.data();
+    const char* data_end = m_queue_buf.data() + m_queue_buf.size();
     while (fragment_start < data_end)
     {
         int fragment_size = data_end - fragment_start;
@@ -201,7 +217,7 @@ void TilesFramework::finish_message()
 
         for (unsigned int i = 0; i < m_dest_addrs.size(); ++i)
         {
-            int retries = 30;
+            const time_t deadline = time(nullptr) + 60;
             ssize_t sent = 0;
             while (sent < fragment_size)
             {
@@ -212,15 +228,22 @@ void TilesFramework::finish_message()
                 {
                     const char *errmsg = retval == 0 ? "No bytes sent"
                                                      : strerror(errno);
-                    if (--retries <= 0)
+                    if (time(nullptr) >= deadline)
                         die("Socket write error: %s", errmsg);
 
                     if (retval == 0 || errno == ENOBUFS || errno == EWOULDBLOCK
                         || errno == EINTR || errno == EAGAIN)
                     {
-                        // Wait for half a second at first (up to five), then
-                        // try again.
-                        usleep(retries <= 10 ? 5000 * 1000 : 500 * 1000);
+                        // Wait until the socket drains instead of
+                        // sleeping for a fixed half second; the short
+                        // sleep guards against poll claiming
+                        // writability while the webserver's queue is
+                        // still full.
+                        pollfd pfd;
+                        pfd.fd = m_sock;
+                        pfd.events = POLLOUT;
+                        if (poll(&pfd, 1, 500) > 0)
+                            usleep(10 * 1000);
                     }
                     else if (errno == ECONNREFUSED || errno == ENOENT)
                     {
@@ -239,7 +262,7 @@ void TilesFramework::finish_message()
 
         fragment_start += fragment_size;
     }
-    m_msg_buf.clear();
+    m_queue_buf.clear();
 }
 
 void TilesFramework::send_message(const char *format, ...)
@@ -266,7 +289,13 @@ void TilesFramework::send_message(const char *format, ...)
 
 void TilesFramework::flush_messages()
 {
+    if (m_send_everything_pending)
+    {
+        m_send_everything_pending = false;
+        _send_everything();
+    }
     send_message("*{\"msg\":\"flush_messages\"}");
+    _send_queued();
 }
 
 void TilesFramework::_await_connection()
@@ -330,9 +359,12 @@ wint_t TilesFramework::_handle_control_message(sockaddr_un addr, string data)
     }
     else if (msgtype == "spectator_joined")
     {
+        // Serialize the full state once at the next flush point rather
+        // than immediately: when several spectators join in a burst (a
+        // game getting linked somewhere), they are all covered by a
+        // single _send_everything() fan-out through the webserver.
         flush_messages();
-        _send_everything();
-        flush_messages();
+        m_send_everything_pending = true;
     }
     else if (msgtype == "menu_scroll")
     {
@@ -451,6 +483,8 @@ void TilesFramework::send_exit_reason(const string& type, const string& message)
     }
     write_message("\"}");
     finish_message();
+    // The game may be exiting; don't leave this sitting in the queue.
+    _send_queued();
 }
 
 void TilesFramework::send_dump_info(const string& type, const string& filename)
@@ -462,6 +496,7 @@ void TilesFramework::send_dump_info(const string& type, const string& filename)
     write_message_escaped(strip_filename_unsafe_chars(filename));
     write_message("\"}");
     finish_message();
+    _send_queued();
 }
 
 void TilesFramework::_send_version()
@@ -812,7 +847,8 @@ void TilesFramework::_send_player(bool force_full)
     for (unsigned int i = 0; i < ENDOFPACK; ++i)
     {
         json_open_object(to_string(i));
-        _send_item(c.inv[i], get_item_info(you.inv[i]), force_full);
+        _send_item(c.inv[i], get_item_info(you.inv[i]),
+                   c.inv_name[i], c.inv_menu_name[i], force_full);
         json_close_object(true);
     }
     json_close_object(true);
@@ -837,6 +873,8 @@ void TilesFramework::_send_player(bool force_full)
 }
 
 void TilesFramework::_send_item(item_info& current, const item_info& next,
+                                string &client_name,
+                                string &client_menu_name,
                                 bool force_full)
 {
     bool changed = false;
@@ -874,21 +912,25 @@ void TilesFramework::_send_item(item_info& current, const item_info& next,
 
     changed |= (current.special != next.special);
 
-    // Derived stuff
+    // Derived stuff.  The names last sent for this slot are cached, so
+    // only the new item's names need building; they're also the more
+    // faithful comparison, being exactly what the client displays.
     if (changed && defined)
     {
         string name = next.name(DESC_A, true, false, true);
-        if (force_full || current.name(DESC_A, true, false, true) != name)
+        if (force_full || client_name != name)
             json_write_string("name", name);
 
         const string prefix = item_prefix(next);
-        const int prefcol = menu_colour(next.name(DESC_INVENTORY), prefix);
+        const string menu_name = next.name(DESC_INVENTORY);
+        const int prefcol = menu_colour(menu_name, prefix);
         if (force_full)
             json_write_int("col", macro_colour(prefcol));
         else
         {
             const string current_prefix = item_prefix(current);
-            const int current_prefcol = menu_colour(current.name(DESC_INVENTORY), current_prefix);
+            const int current_prefcol = menu_colour(client_menu_name,
+                                                    current_prefix);
 
             if (current_prefcol != prefcol)
                 json_write_int("col", macro_colour(prefcol));
@@ -906,6 +948,8 @@ void TilesFramework::_send_item(item_info& current, const item_info& next,
         }
 
         current = next;
+        client_name = name;
+        client_menu_name = menu_name;
     }
 }
 
@@ -1405,6 +1449,12 @@ void TilesFramework::_send_map(bool force_full)
                 last_gc = gc;
             }
             json_close_object(true);
+
+            // Sync the shadow copy cell by cell: a wholesale assignment
+            // of env.map_knowledge would clone the cloud/monster/item
+            // info of every known cell on every update, not just the
+            // handful that actually changed.
+            m_current_map_knowledge(gc) = env.map_knowledge(gc);
         }
     json_close_array(true);
 
@@ -1418,7 +1468,6 @@ void TilesFramework::_send_map(bool force_full)
     if (m_mcache_ref_done)
         _mcache_ref(false);
 
-    m_current_map_knowledge = env.map_knowledge;
     m_current_view = m_next_view;
 
     _mcache_ref(true);
@@ -1898,21 +1947,29 @@ void TilesFramework::write_message_escaped(const string& s)
 {
     m_msg_buf.reserve(m_msg_buf.size() + s.size());
 
-    for (unsigned char c : s)
+    // Copy unescaped runs wholesale; almost all strings sent have
+    // nothing to escape.
+    size_t run_start = 0;
+    for (size_t i = 0; i < s.size(); ++i)
     {
+        const unsigned char c = s[i];
+        if (c != '"' && c != '\\' && c >= 0x20)
+            continue;
+
+        m_msg_buf.append(s, run_start, i - run_start);
         if (c == '"')
             m_msg_buf.append("\\\"");
         else if (c == '\\')
             m_msg_buf.append("\\\\");
-        else if (c < 0x20)
+        else
         {
             char buf[7];
             snprintf(buf, sizeof(buf), "\\u%04x", c);
             m_msg_buf.append(buf);
         }
-        else
-            m_msg_buf.append(1, c);
+        run_start = i + 1;
     }
+    m_msg_buf.append(s, run_start, s.size() - run_start);
 }
 
 void TilesFramework::json_open(const string& name, char opener, char type)
@@ -1992,23 +2049,38 @@ void TilesFramework::json_write_comma()
     if (m_msg_buf.empty()) return;
     char last = m_msg_buf[m_msg_buf.size() - 1];
     if (last == '{' || last == '[' || last == ',' || last == ':') return;
-    write_message(",");
+    m_msg_buf.append(1, ',');
 }
 
 void TilesFramework::json_write_name(const string& name)
 {
     json_write_comma();
 
-    write_message("\"");
+    m_msg_buf.append(1, '"');
     write_message_escaped(name);
-    write_message("\":");
+    m_msg_buf.append("\":");
 }
 
 void TilesFramework::json_write_int(int value)
 {
     json_write_comma();
 
-    write_message("%d", value);
+    // Format by hand: going through vsnprintf is a surprising chunk of
+    // the map update cost when every cell field passes through here.
+    char buf[12];
+    char *const bufend = buf + sizeof(buf);
+    char *p = bufend;
+    unsigned int v = value < 0 ? 0 - (unsigned int)value
+                               : (unsigned int)value;
+    do
+    {
+        *--p = '0' + v % 10;
+        v /= 10;
+    }
+    while (v);
+    if (value < 0)
+        *--p = '-';
+    m_msg_buf.append(p, bufend - p);
 }
 
 void TilesFramework::json_write_int(const string& name, int value)
@@ -2023,10 +2095,7 @@ void TilesFramework::json_write_bool(bool value)
 {
     json_write_comma();
 
-    if (value)
-        write_message("true");
-    else
-        write_message("false");
+    m_msg_buf.append(value ? "true" : "false");
 }
 
 void TilesFramework::json_write_bool(const string& name, bool value)
@@ -2041,7 +2110,7 @@ void TilesFramework::json_write_null()
 {
     json_write_comma();
 
-    write_message("null");
+    m_msg_buf.append("null");
 }
 
 void TilesFramework::json_write_null(const string& name)
@@ -2056,9 +2125,9 @@ void TilesFramework::json_write_string(const string& value)
 {
     json_write_comma();
 
-    write_message("\"");
+    m_msg_buf.append(1, '"');
     write_message_escaped(value);
-    write_message("\"");
+    m_msg_buf.append(1, '"');
 }
 
 void TilesFramework::json_write_string(const string& name, const string& value)
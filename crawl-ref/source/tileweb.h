@@ -75,6 +75,10 @@ struct player_info
     vector<status_info> status;
 
     FixedVector<item_info, ENDOFPACK> inv;
+    // Names as last sent for each inventory slot, kept so updates don't
+    // have to rebuild the client side's item names just to compare.
+    FixedVector<string, ENDOFPACK> inv_name;
+    FixedVector<string, ENDOFPACK> inv_menu_name;
     FixedVector<int8_t, NUM_EQUIP> equip;
     int8_t quiver_item;
     string unarmed_attack;
@@ -203,6 +207,8 @@ protected:
     int m_sock;
     int m_max_msg_size;
     string m_msg_buf;
+    // Completed messages awaiting the next flush point.
+    string m_queue_buf;
     vector<sockaddr_un> m_dest_addrs;
 
     bool m_controlled_from_web;
@@ -210,6 +216,7 @@ protected:
     void _await_connection();
     wint_t _handle_control_message(sockaddr_un addr, string data);
     wint_t _receive_control_message();
+    void _send_queued();
 
     struct JsonFrame
     {
@@ -240,6 +247,10 @@ protected:
     bool m_view_loaded;
     bool m_player_on_level;
 
+    // Set when a spectator joins; the full-state resend is deferred to
+    // the next flush so join bursts are served by a single frame.
+    bool m_send_everything_pending;
+
     FixedArray<screen_cell_t, GXM, GYM> m_current_view;
     coord_def m_current_gc;
 
@@ -300,6 +311,7 @@ protected:
                        bool force_full);
     void _send_player(bool force_full = false);
     void _send_item(item_info& current, const item_info& next,
+                    string &client_name, string &client_menu_name,
                     bool force_full);
 };
 
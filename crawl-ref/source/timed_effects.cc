@@ -1467,15 +1467,16 @@ static void _energize_shadow_traps(int time_taken)
 {
     for (int i = 0; i < MAX_TRAPS; i++)
     {
-        if (env.trap[i].type == TRAP_SHADOW_DORMANT)
+        trap_def &trap = env.trap[i];
+        if (trap.type == TRAP_SHADOW_DORMANT)
         {
-            env.trap[i].ammo_qty -= div_rand_round(time_taken, 10);
-            if (env.trap[i].ammo_qty <= 0)
+            trap.ammo_qty -= div_rand_round(time_taken, 10);
+            if (trap.ammo_qty <= 0)
             {
-                env.trap[i].ammo_qty = 0;
-                env.trap[i].type = TRAP_SHADOW;
-                const coord_def &pos = env.trap[i].pos;
-                grd(pos) = env.trap[i].category();
+                trap.ammo_qty = 0;
+                trap.type = TRAP_SHADOW;
+                const coord_def &pos = trap.pos;
+                grd(pos) = trap.category();
                 if (env.map_knowledge(pos).feat() == DNGN_TRAP_SHADOW_DORMANT)
                     env.map_knowledge(pos).set_feature(grd(pos), 0, TRAP_SHADOW);
                 dprf("activating shadow trap");
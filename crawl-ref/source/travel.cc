@@ -109,6 +109,28 @@ static string trans_travel_dest;
 // hostile terrain.
 travel_distance_grid_t travel_point_distance;
 
+// The seed of the last pure floodout that filled travel_point_distance.
+// While it is set, a repeated floodout from the same spot can reuse the
+// grid as is instead of re-flooding GXM x GYM cells; it is cleared
+// whenever the map, the terrain or the exclusions change, and whenever
+// a pathfind run overwrites the grid for some other query.
+static coord_def _last_flood_seed(-1, -1);
+
+// An explore target precomputed while the game was waiting for input,
+// so that the next autoexplore command can be served without flooding
+// the level first. Keyed on the player's position and turn count: if
+// either has changed by the time the plan would be used, the world has
+// moved on and the plan is quietly recomputed.
+static coord_def _explore_plan_pos(-1, -1);
+static coord_def _explore_plan_target;
+static int _explore_plan_runmode = RMODE_NOT_RUNNING;
+static int _explore_plan_turns = -1;
+
+void travel_distance_map_invalidate()
+{
+    _last_flood_seed = coord_def(-1, -1);
+}
+
 // Apply slime wall checks when checking if squares are travelsafe.
 bool g_Slime_Wall_Check = true;
 
@@ -222,9 +244,12 @@ bool is_unknown_stair(const coord_def &p)
            && feat != DNGN_EXIT_DUNGEON;
 }
 
+static bool _feat_is_traversable(dungeon_feature_type feat, bool try_fallback);
+
 // Returns true if the character can cross this dungeon feature, and
 // the player hasn't requested that travel avoid the feature.
-bool feat_is_traversable_now(dungeon_feature_type grid, bool try_fallback)
+static bool _feat_is_traversable_now(dungeon_feature_type grid,
+                                     bool try_fallback)
 {
     if (!ignore_player_traversability)
     {
@@ -249,12 +274,12 @@ bool feat_is_traversable_now(dungeon_feature_type grid, bool try_fallback)
             return player_can_open_doors();
     }
 
-    return feat_is_traversable(grid, try_fallback);
+    return _feat_is_traversable(grid, try_fallback);
 }
 
 // Returns true if a generic character can cross this dungeon feature.
 // Ignores swimming, flying, and travel_avoid_terrain.
-bool feat_is_traversable(dungeon_feature_type feat, bool try_fallback)
+static bool _feat_is_traversable(dungeon_feature_type feat, bool try_fallback)
 {
     if (feat_is_trap(feat) && feat != DNGN_PASSAGE_OF_GOLUBRIA)
     {
@@ -274,6 +299,62 @@ bool feat_is_traversable(dungeon_feature_type feat, bool try_fallback)
         return false;
 }
 
+// The two traversability checks above run once per cell expansion while
+// pathfinding, so their answers are baked into per-feature planes and
+// each check becomes one array lookup. Everything they depend on --
+// travel options, the connectivity flag, and the player's form, flight
+// and swimming -- is stable within a turn, so the planes are stamped
+// with the turn count (and rebuilt when the connectivity mode toggles
+// the flag mid-pathfind).
+static bool _traversable_plane[2][NUM_FEATURES];
+static bool _traversable_now_plane[2][NUM_FEATURES];
+static int _traversable_plane_turn = -1;
+static bool _traversable_plane_ignore = false;
+static int _traversable_plane_form = -1;
+
+// For prevent_travel_to(): travel options can be adjusted from Lua
+// without a turn passing.
+static void _invalidate_traversable_planes()
+{
+    _traversable_plane_turn = -1;
+}
+
+static void _update_traversable_planes()
+{
+    if (_traversable_plane_turn == you.num_turns
+        && _traversable_plane_ignore == ignore_player_traversability
+        && _traversable_plane_form == you.form)
+    {
+        return;
+    }
+
+    _traversable_plane_turn = you.num_turns;
+    _traversable_plane_ignore = ignore_player_traversability;
+    _traversable_plane_form = you.form;
+
+    for (int feat = 0; feat < NUM_FEATURES; ++feat)
+        for (int fallback = 0; fallback <= 1; ++fallback)
+        {
+            const dungeon_feature_type ft = (dungeon_feature_type) feat;
+            _traversable_plane[fallback][feat] =
+                _feat_is_traversable(ft, fallback);
+            _traversable_now_plane[fallback][feat] =
+                _feat_is_traversable_now(ft, fallback);
+        }
+}
+
+bool feat_is_traversable_now(dungeon_feature_type grid, bool try_fallback)
+{
+    _update_traversable_planes();
+    return _traversable_now_plane[try_fallback][grid];
+}
+
+bool feat_is_traversable(dungeon_feature_type feat, bool try_fallback)
+{
+    _update_traversable_planes();
+    return _traversable_plane[try_fallback][feat];
+}
+
 static const char *_run_mode_name(int runmode)
 {
     return runmode == RMODE_TRAVEL         ? "travel" :
@@ -537,7 +618,10 @@ void prevent_travel_to(const string &feature)
 {
     int feature_type = _get_feature_type(feature);
     if (feature_type != -1)
+    {
         forbidden_terrain[feature_type] = 1;
+        _invalidate_traversable_planes();
+    }
 }
 
 static bool _is_branch_stair(const coord_def& pos)
@@ -698,11 +782,66 @@ static void _set_target_square(const coord_def &target)
     you.running.pos = target;
 }
 
+// Precomputes the next explore target while the game is idle, waiting
+// for input. The game loop is single-threaded, so rather than planning
+// on a background thread this runs the explore flood just before the
+// input prompt, after the world has settled; if the player's next
+// command is another autoexplore from the same square, the plan is
+// served without re-flooding the level. Anything that would need
+// messages, fallback handling or anti-zigzag state is left to
+// _explore_find_target_square().
+void explore_plan_precompute()
+{
+    if (crawl_state.prev_cmd != CMD_EXPLORE || you.running
+        || _explore_plan_pos == you.pos()
+           && _explore_plan_turns == you.num_turns)
+    {
+        return;
+    }
+
+    const run_mode_type rmode = Options.explore_greedy ? RMODE_EXPLORE_GREEDY
+                                                       : RMODE_EXPLORE;
+
+    travel_pathfind tp;
+    tp.set_floodseed(you.pos(), true);
+
+    const coord_def whereto = tp.pathfind(rmode);
+    if (!whereto.x && !whereto.y)
+        return;
+
+    if (travel_point_distance[whereto.x][whereto.y] <= 0
+        && whereto != you.pos())
+    {
+        return;
+    }
+
+    // Needs anti-zigzag treatment; let the real call sort it out.
+    if (Options.explore_improved && whereto == tp.unexplored_square())
+        return;
+
+    _explore_plan_pos     = you.pos();
+    _explore_plan_target  = whereto;
+    _explore_plan_runmode = rmode;
+    _explore_plan_turns   = you.num_turns;
+}
+
 static void _explore_find_target_square()
 {
     bool fallback = false;
     bool runed_door_pause = false;
 
+    // Serve a plan precomputed while waiting for input, if it is still
+    // current.
+    if (_explore_plan_pos == you.pos()
+        && _explore_plan_turns == you.num_turns
+        && _explore_plan_runmode == you.running.runmode)
+    {
+        _explore_plan_pos = coord_def(-1, -1);
+        _set_target_square(_explore_plan_target);
+        _reset_zigzag_info();
+        return;
+    }
+
     travel_pathfind tp;
     tp.set_floodseed(you.pos(), true);
 
@@ -1311,6 +1450,7 @@ coord_def travel_pathfind::pathfind(run_mode_type rmode, bool fallback_explore)
     // point_distance will hold the distance of all points from the starting
     // point, i.e. the distance travelled to get there.
     memset(point_distance, 0, sizeof(travel_distance_grid_t));
+    travel_distance_map_invalidate();
 
     if (!in_bounds(start))
         return coord_def();
@@ -1768,6 +1908,13 @@ void find_travel_pos(const coord_def& youpos,
                      int *move_x, int *move_y,
                      vector<coord_def>* features)
 {
+    // A pure floodout only fills travel_point_distance; if nothing has
+    // changed since the last floodout from this very spot, the grid is
+    // still current and there's no need to re-flood.
+    const bool flood_only = !move_x && !move_y && !features;
+    if (flood_only && youpos == _last_flood_seed)
+        return;
+
     travel_pathfind tp;
 
     if (move_x && move_y)
@@ -1785,6 +1932,9 @@ void find_travel_pos(const coord_def& youpos,
         dest = tp.pathfind(rmode, true);
     coord_def new_dest = dest;
 
+    if (flood_only)
+        _last_flood_seed = youpos;
+
     if (grd(dest) == DNGN_RUNED_DOOR)
     {
         move_x = 0;
@@ -3285,6 +3435,9 @@ bool LevelInfo::empty() const
 void LevelInfo::update_excludes()
 {
     excludes = curr_excludes;
+    // Exclusions feed into travel safety, so the cached stair distance
+    // matrix is no longer trustworthy.
+    distance_update_turns = -1;
 }
 
 void LevelInfo::update()
@@ -3296,17 +3449,41 @@ void LevelInfo::update()
     vector<coord_def> stair_positions;
     get_stairs(stair_positions);
 
+    // Remember the stair list we had, so we can tell whether correcting
+    // it below actually changed anything.
+    vector<coord_def> old_stairs;
+    old_stairs.reserve(stairs.size());
+    for (int i = 0, sz = stairs.size(); i < sz; ++i)
+        old_stairs.push_back(stairs[i].position);
+
     // Make sure our stair list is correct.
     correct_stair_list(stair_positions);
 
     sync_all_branch_stairs();
 
+    bool stairs_changed = old_stairs.size() != stairs.size();
+    for (int i = 0, sz = old_stairs.size(); !stairs_changed && i < sz; ++i)
+        stairs_changed = old_stairs[i] != stairs[i].position;
+
+    // The stair distance matrix is the expensive part: one flood fill
+    // per stair. Interlevel route planning calls update() repeatedly in
+    // the course of a single query, so skip the recomputation while the
+    // stair list and the turn count are unchanged; everything that can
+    // change the distances in between (exclusions, newly seen stairs)
+    // resets distance_update_turns.
+    if (!stairs_changed && distance_update_turns == you.num_turns)
+    {
+        update_daction_counters(this);
+        return;
+    }
+
     // If the player isn't immune to slimy walls, precalculate
     // neighbours of slimy walls now.
     unwind_slime_wall_precomputer slime_wall_neighbours(
         !actor_slime_wall_immune(&you));
     precompute_travel_safety_grid travel_safety_calc;
     update_stair_distances();
+    distance_update_turns = you.num_turns;
 
     update_daction_counters(this);
 }
@@ -68,6 +68,14 @@ bool is_unknown_stair(const coord_def &p);
 void find_travel_pos(const coord_def& youpos, int *move_x, int *move_y,
                      vector<coord_def>* coords = nullptr);
 
+// Forget the last filled travel distance map; call whenever the map,
+// the terrain or the exclusions change.
+void travel_distance_map_invalidate();
+
+// Plan the next autoexplore step ahead of time, while the game is
+// waiting for input.
+void explore_plan_precompute();
+
 bool is_stair_exclusion(const coord_def &p);
 
 /* ***********************************************************************
@@ -291,7 +299,8 @@ public:
 // Information on a level that interlevel travel needs.
 struct LevelInfo
 {
-    LevelInfo() : stairs(), excludes(), stair_distances(), id()
+    LevelInfo() : stairs(), excludes(), stair_distances(), id(),
+                  distance_update_turns(-1)
     {
         daction_counters.init(0);
     }
@@ -360,6 +369,11 @@ private:
     vector<short> stair_distances;  // Dist between stairs
     level_id id;
 
+    // Turn count when stair_distances was last recomputed, so repeated
+    // interlevel route queries in the same turn don't re-flood the level
+    // once per stair. Not saved; distances are recomputed after a load.
+    int distance_update_turns;
+
     friend class TravelCache;
 
 private:
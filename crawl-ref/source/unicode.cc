@@ -476,9 +476,18 @@ int strwidth(const char *s)
     ucs_t c;
     int w = 0;
 
-    while (int l = utf8towc(&c, s))
+    while (*s)
     {
-        s += l;
+        // Printable ASCII is one byte and one column; mostly-ASCII
+        // strings (nearly everything we measure) skip the decode and
+        // the wcwidth() call entirely.
+        if ((unsigned char)*s >= 0x20 && (unsigned char)*s < 0x7f)
+        {
+            w++;
+            s++;
+            continue;
+        }
+        s += utf8towc(&c, s);
         int cw = wcwidth(c);
         if (cw != -1) // shouldn't ever happen
             w += cw;
@@ -536,9 +545,20 @@ string chop_string(const char *s, int width, bool spaces)
     const char *s0 = s;
     ucs_t c;
 
-    while (int clen = utf8towc(&c, s))
+    while (*s)
     {
-        int cw = wcwidth(c);
+        int clen, cw;
+        // Same printable-ASCII fast path as strwidth().
+        if ((unsigned char)*s >= 0x20 && (unsigned char)*s < 0x7f)
+        {
+            clen = 1;
+            cw = 1;
+        }
+        else
+        {
+            clen = utf8towc(&c, s);
+            cw = wcwidth(c);
+        }
         // Due to combining chars, we can't stop at merely reaching the
         // target width, the next character needs to exceed it.
         if (cw > width) // note: a CJK character might leave one space left
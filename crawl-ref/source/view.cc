@@ -75,8 +75,30 @@
 
 static bool _show_terrain = false;
 
+// Dirty-cell tracking for viewwindow(): cells whose map knowledge or show
+// info changed since the last draw. When nothing forces a full redraw,
+// only these cells are re-rendered into the view buffer.
+static vector<coord_def> _dirty_cells;
+static vector<coord_def> _last_view_cells;
+static bool _all_dirty = true;
+static bool _last_draw_special = false;
+static coord_def _last_vgrdc(-1000, -1000);
+static coord_def _last_viewsz(-1, -1);
+
 crawl_view_geometry crawl_view;
 
+void view_mark_dirty(const coord_def &gc)
+{
+    if (!_all_dirty)
+        _dirty_cells.push_back(gc);
+}
+
+void view_mark_all_dirty()
+{
+    _all_dirty = true;
+    _dirty_cells.clear();
+}
+
 bool handle_seen_interrupt(monster* mons, vector<string>* msgs_buf)
 {
     activity_interrupt_data aid(mons);
@@ -526,6 +548,14 @@ bool magic_mapping(int map_radius, int proportion, bool suppress_msg,
     if (map_radius < 5)
         map_radius = 5;
 
+    // A level-scale reveal touches most of the map; issue one bulk
+    // invalidation up front rather than pushing thousands of cells onto
+    // the dirty list one at a time (view_mark_dirty() no-ops once the
+    // whole view is marked).  Small sweeps -- passive mapping runs one
+    // every time a new square is seen -- keep their per-cell marks.
+    if (wizard_map || map_radius >= GXM)
+        view_mark_all_dirty();
+
     // now gradually weaker with distance:
     const int pfar     = dist_range(map_radius * 7 / 10);
     const int very_far = dist_range(map_radius * 9 / 10);
@@ -661,6 +691,7 @@ bool magic_mapping(int map_radius, int proportion, bool suppress_msg,
 
 void fully_map_level()
 {
+    view_mark_all_dirty();
     for (rectangle_iterator ri(1); ri; ++ri)
     {
         bool ok = false;
@@ -1313,13 +1344,40 @@ void viewwindow(bool show_updates, bool tiles_only, animation *a)
 #endif
 
         show_init(_show_terrain);
+
+        // show_init() marked every cell now in view as dirty; cells that
+        // were in view last turn may have left it and need to be redrawn
+        // as out-of-view too.
+        for (const coord_def &gc : _last_view_cells)
+            view_mark_dirty(gc);
+        _last_view_cells.clear();
+        if (crawl_state.game_is_arena())
+            view_mark_all_dirty();
+        else
+        {
+            for (radius_iterator ri(you.pos(),
+                                    you.xray_vision ? LOS_NONE : LOS_DEFAULT);
+                 ri; ++ri)
+            {
+                _last_view_cells.push_back(*ri);
+            }
+        }
     }
 
     if (show_updates)
         player_view_update();
 
-    bool run_dont_draw = you.running && Options.travel_delay < 0
-                && (!you.running.is_explore() || Options.explore_delay < 0);
+    // Each run mode defers to its own delay option: resting with
+    // rest_delay = -1 skips the per-turn redraw even if travel draws.
+    // Repeated commands (100s and the like) are rest-flavoured, so they
+    // follow rest_delay too; the final state is drawn when they finish.
+    bool run_dont_draw = (you.running
+                && (you.running.is_rest()
+                    ? Options.rest_delay < 0
+                    : Options.travel_delay < 0
+                      && (!you.running.is_explore()
+                          || Options.explore_delay < 0)))
+            || crawl_state.is_repeating_cmd() && Options.rest_delay < 0;
 
     if (run_dont_draw || you.asleep())
     {
@@ -1337,20 +1395,55 @@ void viewwindow(bool show_updates, bool tiles_only, animation *a)
 
     const coord_def tl = coord_def(1, 1);
     const coord_def br = crawl_view.viewsz;
-    for (rectangle_iterator ri(tl, br); ri; ++ri)
+
+    // Flashes, animations and targeting overlays touch cells that aren't
+    // tracked as dirty, both when they appear and when they go away; so
+    // do viewport scrolls and resizes.
+    const bool special_draw = a || flash_colour != BLACK || you.flash_where
+                              || crawl_state.darken_range;
+    bool full_redraw = _all_dirty || special_draw || _last_draw_special
+                       || _show_terrain
+                       || crawl_view.vgrdc != _last_vgrdc
+                       || crawl_view.viewsz != _last_viewsz;
+#ifdef USE_TILE
+    // Tile flavour animations tick in draw_cell; don't freeze them on
+    // cells that happen to be clean.
+    full_redraw = full_redraw || anim_updates;
+#endif
+
+    if (full_redraw)
     {
-        // in grid coords
-        const coord_def gc = a
-            ? a->cell_cb(view2grid(*ri), flash_colour)
-            : view2grid(*ri);
+        for (rectangle_iterator ri(tl, br); ri; ++ri)
+        {
+            // in grid coords
+            const coord_def gc = a
+                ? a->cell_cb(view2grid(*ri), flash_colour)
+                : view2grid(*ri);
 
-        if (you.flash_where && you.flash_where->is_affected(gc) <= 0)
-            draw_cell(cell, gc, anim_updates, 0);
-        else
-            draw_cell(cell, gc, anim_updates, flash_colour);
+            if (you.flash_where && you.flash_where->is_affected(gc) <= 0)
+                draw_cell(cell, gc, anim_updates, 0);
+            else
+                draw_cell(cell, gc, anim_updates, flash_colour);
 
-        cell++;
+            cell++;
+        }
+    }
+    else
+    {
+        for (const coord_def &gc : _dirty_cells)
+        {
+            const coord_def vc = grid2view(gc);
+            if (vc.x < 1 || vc.y < 1 || vc.x > br.x || vc.y > br.y)
+                continue;
+            draw_cell(cell + (vc.y - 1) * br.x + (vc.x - 1), gc,
+                      anim_updates, 0);
+        }
     }
+    _dirty_cells.clear();
+    _all_dirty = false;
+    _last_draw_special = special_draw;
+    _last_vgrdc = crawl_view.vgrdc;
+    _last_viewsz = crawl_view.viewsz;
 
     you.last_view_update = you.num_turns;
 #ifndef USE_TILE_LOCAL
@@ -1493,6 +1586,7 @@ void draw_cell(screen_cell_t *cell, const coord_def &gc,
 void toggle_show_terrain()
 {
     _show_terrain = !_show_terrain;
+    view_mark_all_dirty();
     if (_show_terrain)
     {
         mprf("Showing terrain only. Press <w>%s</w> to return to normal view.",
@@ -1505,6 +1599,7 @@ void toggle_show_terrain()
 void reset_show_terrain()
 {
     _show_terrain = false;
+    view_mark_all_dirty();
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,13 @@ class targetter;
 
 static inline void scaled_delay(unsigned int ms)
 {
+    // view_delay = 0 turns animation waits off; skip the per-frame
+    // screen refresh (and, for webtiles, the per-frame client redraw)
+    // too instead of flushing every frame of an animation nobody can
+    // see.  The final state is shown by the next real redraw.
+    if (Options.view_delay <= 0)
+        return;
+
     delay(ms * Options.view_delay / DEFAULT_VIEW_DELAY);
 }
 
@@ -72,6 +79,11 @@ void viewwindow(bool show_updates = true, bool tiles_only = false,
 void draw_cell(screen_cell_t *cell, const coord_def &gc,
                bool anim_updates, int flash_colour);
 
+// Record that the cell at gc changed and needs re-rendering on the next
+// viewwindow() call; bulk changes should use view_mark_all_dirty().
+void view_mark_dirty(const coord_def &gc);
+void view_mark_all_dirty();
+
 void update_monsters_in_view();
 bool handle_seen_interrupt(monster* mons, vector<string>* msgs_buf = nullptr);
 void flush_comes_into_view();
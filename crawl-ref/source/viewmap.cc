@@ -328,11 +328,12 @@ static void _draw_level_map(int start_x, int start_y, bool travel_mode,
             }
             else
             {
-                cglyph_t g = get_cell_glyph(c, false, -1);
+                const map_cell& mcell = env.map_knowledge(c);
+                cglyph_t g = get_cell_glyph(mcell, c, false, -1);
                 cell->glyph = g.ch;
                 cell->colour = g.col;
 
-                const show_class show = get_cell_show_class(env.map_knowledge(c));
+                const show_class show = get_cell_show_class(mcell);
 
                 if (show == SH_NOTHING && _is_explore_horizon(c))
                 {
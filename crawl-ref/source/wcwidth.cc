@@ -210,6 +210,12 @@ int wcwidth(ucs_t ucs)
     if (ucs < 32 || (ucs >= 0x7f && ucs < 0xa0))
         return -1;
 
+    /* everything below the first combining interval is single-width;
+     * this covers ASCII and Latin-1 (i.e. nearly every character the
+     * game draws) without the binary search or the wide tests below */
+    if (ucs < combining[0].first)
+        return 1;
+
     /* binary search in table of non-spacing characters */
     if (bisearch(ucs, combining, ARRAYSZ(combining) - 1))
         return 0;
@@ -893,20 +893,43 @@ bool SDLWrapper::load_texture(GenericTexture *tex, const char *filename,
         pixels = new unsigned char[4 * new_width * new_height];
         memset(pixels, 0, 4 * new_width * new_height);
 
-        int dest = 0;
-        for (int y = 0; y < img->h; y++)
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        const Uint32 rmask = 0x000000ff, gmask = 0x0000ff00,
+                     bmask = 0x00ff0000, amask = 0xff000000;
+#else
+        const Uint32 rmask = 0xff000000, gmask = 0x00ff0000,
+                     bmask = 0x0000ff00, amask = 0x000000ff;
+#endif
+        if (img->format->Rmask == rmask && img->format->Gmask == gmask
+            && img->format->Bmask == bmask && img->format->Amask == amask)
         {
-            for (int x = 0; x < img->w; x++)
+            // The common case: the decoded image is already laid out as
+            // RGBA bytes, so copy whole rows instead of calling
+            // SDL_GetRGBA once per pixel of every sheet.
+            for (int y = 0; y < img->h; y++)
             {
-                unsigned char *p = ((unsigned char*)img->pixels
-                                  + y * img->pitch + x * bpp);
-                unsigned int pixel = *(unsigned int*)p;
-                SDL_GetRGBA(pixel, img->format, &pixels[dest],
-                            &pixels[dest+1], &pixels[dest+2],
-                            &pixels[dest+3]);
-                dest += 4;
+                memcpy(pixels + 4 * new_width * y,
+                       (unsigned char*)img->pixels + y * img->pitch,
+                       4 * img->w);
+            }
+        }
+        else
+        {
+            int dest = 0;
+            for (int y = 0; y < img->h; y++)
+            {
+                for (int x = 0; x < img->w; x++)
+                {
+                    unsigned char *p = ((unsigned char*)img->pixels
+                                      + y * img->pitch + x * bpp);
+                    unsigned int pixel = *(unsigned int*)p;
+                    SDL_GetRGBA(pixel, img->format, &pixels[dest],
+                                &pixels[dest+1], &pixels[dest+2],
+                                &pixels[dest+3]);
+                    dest += 4;
+                }
+                dest += 4 * (new_width - img->w);
             }
-            dest += 4 * (new_width - img->w);
         }
 
         SDL_UnlockSurface(img);
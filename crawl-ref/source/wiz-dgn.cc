@@ -606,12 +606,18 @@ static void debug_load_map_by_name(string name, bool primary)
         unwind_var<string_set> umt(you.uniq_map_tags, string_set());
         unwind_var<string_set> lum(env.level_uniq_maps, string_set());
         unwind_var<string_set> lumt(env.level_uniq_map_tags, string_set());
-        if (dgn_place_map(toplace, false, false, where))
+        if (const vault_placement *vp =
+                dgn_place_map(toplace, false, false, where))
         {
             mprf("Successfully placed %s.", toplace->name.c_str());
             // Fix up doors from vaults and any changes to the default walls
-            // and floors from the vault.
-            tile_init_flavour();
+            // and floors from the vault.  Only the vault's footprint (plus
+            // a border, for gates straddling its edge) can have changed.
+            for (rectangle_iterator ri(vp->pos - coord_def(1, 1),
+                                       vp->pos + vp->size); ri; ++ri)
+            {
+                tile_init_flavour(*ri);
+            }
         }
         else
             mprf("Failed to place %s.", toplace->name.c_str());
@@ -8,6 +8,7 @@
 #include "wiz-fsim.h"
 
 #include <cerrno>
+#include <ctime>
 
 #include "beam.h"
 #include "bitary.h"
@@ -323,9 +324,14 @@ static void _uninit_fsim(monster *mon)
     reset_training();
 }
 
+// Attack iterations run since the current simulation started; used to
+// report the simulation's throughput when it finishes.
+static int _fsim_iterations = 0;
+
 static fight_data _get_fight_data(monster &mon, int iter_limit, bool defend)
 {
     const monster orig = mon;
+    _fsim_iterations += iter_limit;
     unsigned int cumulative_damage = 0;
     unsigned int time_taken = 0;
     int hits = 0;
@@ -678,6 +684,9 @@ void wizard_fight_sim(bool double_scale)
     void (*fsim_proc)(FILE * o, monster* mon, bool defense) = nullptr;
     fsim_proc = double_scale ? _fsim_double_scale : _fsim_simple_scale;
 
+    _fsim_iterations = 0;
+    const clock_t fsim_start = clock();
+
     if (Options.fsim_kit.empty())
         fsim_proc(o, mon, defense);
     else
@@ -709,7 +718,16 @@ void wizard_fight_sim(bool double_scale)
         set_xl(xl, false);
 
     _uninit_fsim(mon);
-    mpr("Done.");
+
+    // Report throughput, so fsim doubles as a crude combat-path benchmark.
+    const double secs = double(clock() - fsim_start) / CLOCKS_PER_SEC;
+    if (secs > 0 && _fsim_iterations)
+    {
+        mprf("Done: %d iterations in %.1f seconds (%.0f iters/sec).",
+             _fsim_iterations, secs, _fsim_iterations / secs);
+    }
+    else
+        mpr("Done.");
 }
 
 #endif
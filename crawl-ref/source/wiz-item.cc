@@ -696,6 +696,8 @@ void wizard_unidentify_pack()
 
 void wizard_list_items()
 {
+    mprf("%d of %d mitm slots are in use.", count_mitm_items(), MAX_ITEMS);
+
     mpr("Item stacks (by location and top item):");
     for (int i = 0; i < MAX_ITEMS; ++i)
     {
@@ -1868,7 +1868,7 @@ static int _xom_change_scenery(bool debug = false)
                     == end(closed_doors))
             {
                 // If it's a gate, add all doors belonging to the gate.
-                set<coord_def> all_door;
+                coord_set all_door;
                 find_connected_identical(*ri, all_door);
                 for (auto dc : all_door)
                     closed_doors.push_back(dc);
@@ -1883,7 +1883,7 @@ static int _xom_change_scenery(bool debug = false)
             {
                 // Check whether any of the doors belonging to a gate is
                 // blocked by an item or monster.
-                set<coord_def> all_door;
+                coord_set all_door;
                 find_connected_identical(*ri, all_door);
                 bool is_blocked = false;
                 for (auto dc : all_door)
@@ -140,6 +140,12 @@ static void _zotdef_fill_from_list(monster_type mlist[], int chance, int power)
         ls++;
     ASSERT(ls > 0);
 
+    // Strengths are fixed per list; look each up once rather than per
+    // rejection-sampling attempt.
+    vector<int> strength(ls);
+    for (int i = 0; i < ls; i++)
+        strength[i] = _mon_strength(mlist[i]);
+
     for (int i = 0; i <= NSLOTS; i++)
     {
         env.mons_alloc[i] = MONS_PROGRAM_BUG;
@@ -147,10 +153,11 @@ static void _zotdef_fill_from_list(monster_type mlist[], int chance, int power)
              continue;        // no monster this entry
         while (env.mons_alloc[i] == MONS_PROGRAM_BUG)
         {
-            monster_type mon_type = mlist[random2(ls)];
-            if (random2(power * 3 / 2) > _mon_strength(mon_type))
+            const int pick = random2(ls);
+            monster_type mon_type = mlist[pick];
+            if (random2(power * 3 / 2) > strength[pick])
                 continue;        // bias away from weaker critters
-            if (random2(power * 3 / 2) > _mon_strength(mon_type))
+            if (random2(power * 3 / 2) > strength[pick])
                 env.mons_alloc[i] = mon_type;
             if (one_chance_in(100))
                 env.mons_alloc[i] = mon_type;      // occasional random pick